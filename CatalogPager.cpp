@@ -0,0 +1,117 @@
+/**
+ * Catalog Pager Implementation
+ */
+
+#include "CatalogPager.h"
+#include "ContentStore.h"
+
+void CatalogPager::clear() {
+    items.clear();
+    items.shrink_to_fit();
+    nextCursor = "";
+    catalogEtag = "";
+    totalCount = -1;
+    started = false;
+    ready = false;
+    complete = false;
+    // The worker still owns `incoming` - let the job finish and ignore it
+    if (job) dropResult = true;
+}
+
+void CatalogPager::loadCache() {
+    items = contentStore.loadCatalog(kind);
+    totalCount = -1;
+    complete = true;
+    ready = true;
+}
+
+void CatalogPager::start(SENetworkManager& network, ContentKind contentKind, bool useNetwork) {
+    clear();
+    kind = contentKind;
+    started = true;
+
+    if (!useNetwork) {
+        loadCache();
+        return;
+    }
+    // With an old page still in flight, update() requests the first page
+    // once it lands
+    if (!job) requestPage(network, "");
+}
+
+void CatalogPager::requestPage(SENetworkManager& network, const String& cursor) {
+    incoming = CatalogPage();
+    incomingResult = FETCH_FAILED;
+    requestingFirst = cursor.isEmpty();
+    ContentKind k = kind;
+    job = network.submitJob([this, &network, k, cursor]() {
+        incomingResult = network.fetchCatalogPage(k, cursor, incoming);
+    });
+}
+
+bool CatalogPager::update(SENetworkManager& network) {
+    if (!job || !network.isJobDone(job)) return false;
+    job = 0;
+
+    if (dropResult) {
+        dropResult = false;
+        incoming = CatalogPage();
+        if (started && !ready) requestPage(network, "");
+        return false;
+    }
+
+    if (incomingResult == FETCH_NOT_MODIFIED) {
+        // The whole cached catalog is current
+        loadCache();
+    } else if (incomingResult == FETCH_UPDATED) {
+        if (requestingFirst) {
+            items.clear();
+            catalogEtag = incoming.etag;
+        }
+        items.reserve(items.size() + incoming.items.size());
+        for (auto& item : incoming.items) items.push_back(std::move(item));
+        nextCursor = incoming.nextCursor;
+        totalCount = incoming.totalCount;
+        complete = nextCursor.isEmpty();
+        ready = true;
+
+        // The flash copy and its ETag are replaced only by a complete list -
+        // saving a partial one would truncate the offline catalog
+        if (complete) {
+            contentStore.saveCatalog(kind, items);
+            contentStore.saveEtag(kind, "", catalogEtag);
+        }
+        Serial.printf("[CATALOG] %d/%d loaded%s\n", items.size(), totalCount, complete ? " (complete)" : "");
+    } else if (requestingFirst) {
+        // Offline - show whatever was cached
+        loadCache();
+    } else {
+        // Keep what is loaded rather than retrying on every scroll
+        Serial.println("[CATALOG] Page fetch failed - list stops here");
+        complete = true;
+        totalCount = -1;
+    }
+
+    incoming = CatalogPage();
+    return true;
+}
+
+void CatalogPager::prefetch(SENetworkManager& network, int selectedIndex) {
+    if (!ready || complete || job) return;
+    if ((int)items.size() >= CATALOG_MAX_ROWS) return;   // Nothing past the last row can be selected
+    if (selectedIndex + CATALOG_PREFETCH >= (int)items.size()) {
+        requestPage(network, nextCursor);
+    }
+}
+
+int CatalogPager::displayCount() const {
+    int count;
+    if (complete) count = items.size();
+    else if (totalCount > (int)items.size()) count = totalCount;   // X-Total-Count is the server's word - clamp it
+    else count = items.size() + 1;
+    return count < CATALOG_MAX_ROWS ? count : CATALOG_MAX_ROWS;
+}
+
+const char* CatalogPager::titleAt(int index) const {
+    return isLoaded(index) ? items[index].title.c_str() : "Loading...";
+}
@@ -0,0 +1,66 @@
+/**
+ * Catalog Pager - Exam, deck and quiz lists loaded a page at a time
+ * The selection screen opens as soon as the first page arrives; the next
+ * page is requested on the network worker when the selection nears the end
+ * of what is loaded. Each page is parsed item by item, so parsing costs the
+ * same for a 10-entry catalog as for a 1000-entry one, and RAM only grows
+ * with the pages the user actually scrolls to.
+ */
+
+#ifndef CATALOG_PAGER_H
+#define CATALOG_PAGER_H
+
+#include <Arduino.h>
+#include <vector>
+#include "NetworkManager.h"
+
+#define CATALOG_PREFETCH  5     // Request the next page this many rows before the end
+#define CATALOG_MAX_ROWS  200   // Rows a list can show; the selection screens build one name per row on the stack
+
+class CatalogPager {
+private:
+    ContentKind kind = CONTENT_EXAM;
+    std::vector<ExamMetadata> items;
+    String nextCursor;
+    String catalogEtag;        // From the first page, stored with the list once it is complete
+    int totalCount = -1;
+    bool started = false;
+    bool ready = false;        // First page (or the cache) is in
+    bool complete = false;     // No more pages to fetch
+
+    // Page in flight on the network worker. `incoming` is only touched by
+    // the worker until the job is done, then merged on the main loop.
+    NetJobId job = 0;
+    bool requestingFirst = false;
+    bool dropResult = false;   // Cleared while a page was in flight
+    CatalogPage incoming;
+    volatile FetchResult incomingResult = FETCH_FAILED;
+
+    void requestPage(SENetworkManager& network, const String& cursor);
+    void loadCache();
+
+public:
+    // Opens the list - from the backend when useNetwork, else from flash
+    void start(SENetworkManager& network, ContentKind kind, bool useNetwork);
+    void clear();
+
+    // Merges a finished page. Returns true when the list changed.
+    bool update(SENetworkManager& network);
+
+    // Requests the next page when `selectedIndex` is close to the end
+    void prefetch(SENetworkManager& network, int selectedIndex);
+
+    bool isStarted() const { return started; }
+    bool isReady() const { return ready; }
+    size_t size() const { return items.size(); }
+
+    // Rows to show: the full catalog when the server sent its size, so the
+    // pot keeps the same mapping as pages arrive; otherwise the loaded items
+    // plus one "Loading..." row. Never more than CATALOG_MAX_ROWS.
+    int displayCount() const;
+    const char* titleAt(int index) const;
+    bool isLoaded(int index) const { return index >= 0 && index < (int)items.size(); }
+    const ExamMetadata& item(int index) const { return items[index]; }
+};
+
+#endif
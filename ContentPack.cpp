@@ -0,0 +1,400 @@
+/**
+ * Content Pack Implementation
+ * Writers lay out header, record table and string pool in one sequential
+ * pass (pool offsets are assigned up front), so no seeking on write.
+ */
+
+#include "ContentPack.h"
+
+// ===================================================================================
+// WRITER
+// ===================================================================================
+
+// Assigns pool offsets in insertion order; entries are written after the records
+class PoolBuilder {
+public:
+    uint32_t add(const char* s) {
+        if (!s) s = "";
+        uint32_t ref = size;
+        uint16_t len = entryLength(strlen(s));
+        entries.push_back({s, len});
+        size += 2 + len + 1;
+        return ref;
+    }
+    uint32_t add(const String& s) { return add(s.c_str()); }
+
+    bool write(File& f) {
+        for (const Entry& e : entries) {
+            if (f.write((const uint8_t*)&e.len, 2) != 2) return false;
+            if (e.len && f.write((const uint8_t*)e.text, e.len) != e.len) return false;
+            if (f.write((uint8_t)0) != 1) return false;
+        }
+        return true;
+    }
+
+    uint32_t size = 0;
+
+private:
+    struct Entry {
+        const char* text;   // Owned by the struct being written
+        uint16_t len;
+    };
+    std::vector<Entry> entries;
+
+    static uint16_t entryLength(size_t len) {
+        return len > PACK_MAX_STRING ? PACK_MAX_STRING : len;
+    }
+};
+
+static PackHeader makeHeader(PackKind kind, uint16_t recordSize, uint32_t count) {
+    PackHeader hdr = {};
+    hdr.magic = PACK_MAGIC;
+    hdr.version = PACK_VERSION;
+    hdr.kind = kind;
+    hdr.recordSize = recordSize;
+    hdr.itemCount = count;
+    hdr.recordOffset = sizeof(PackHeader);
+    hdr.poolOffset = sizeof(PackHeader) + (uint32_t)recordSize * count;
+    return hdr;
+}
+
+template <typename Record>
+static bool writePack(File& f, PackHeader& hdr, const std::vector<Record>& records, PoolBuilder& pool) {
+    hdr.poolSize = pool.size;
+    if (f.write((const uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (!records.empty()) {
+        size_t bytes = records.size() * sizeof(Record);
+        if (f.write((const uint8_t*)records.data(), bytes) != bytes) return false;
+    }
+    return pool.write(f);
+}
+
+bool PackWriter::writeDeck(File& f, const Deck& deck) {
+    PoolBuilder pool;
+    PackHeader hdr = makeHeader(PACK_DECK, sizeof(PackCardRecord), deck.cards.size());
+    hdr.idRef = pool.add(deck.id);
+    hdr.titleRef = pool.add(deck.title);
+
+    std::vector<PackCardRecord> records(deck.cards.size());
+    for (size_t i = 0; i < deck.cards.size(); i++) {
+        records[i].frontRef = pool.add(deck.cards[i].front);
+        records[i].backRef = pool.add(deck.cards[i].back);
+    }
+    return writePack(f, hdr, records, pool);
+}
+
+// Pool is a PoolBuilder, or the PackSpooler writing strings straight to flash
+template <typename Pool>
+static void fillQuestionRecord(const Question& q, PackQuestionRecord& rec, Pool& pool) {
+    memset(&rec, 0xFF, sizeof(rec));  // Unused option slots read as PACK_NO_STRING
+    rec.id = q.id;
+    rec.type = (q.kind == QUESTION_MCQ) ? PACK_Q_MCQ : PACK_Q_SHORT_ANSWER;
+    rec.optionCount = q.optionCount > PACK_MAX_OPTIONS ? PACK_MAX_OPTIONS : q.optionCount;
+    rec.correctOption = q.correctOption;
+    rec.reserved = 0;
+    rec.textRef = pool.add(q.text);
+    for (uint8_t o = 0; o < rec.optionCount; o++) {
+        rec.optionRefs[o] = pool.add(q.options[o]);
+    }
+    if (q.kind == QUESTION_SHORT_ANSWER) rec.correctTextRef = pool.add(q.correctText);
+}
+
+bool PackWriter::writeQuiz(File& f, const Quiz& quiz) {
+    PoolBuilder pool;
+    PackHeader hdr = makeHeader(PACK_QUIZ, sizeof(PackQuestionRecord), quiz.questions.size());
+    hdr.idRef = pool.add(quiz.id);
+    hdr.titleRef = pool.add(quiz.title);
+
+    std::vector<PackQuestionRecord> records(quiz.questions.size());
+    for (size_t i = 0; i < quiz.questions.size(); i++) {
+        fillQuestionRecord(quiz.questions[i], records[i], pool);
+    }
+    return writePack(f, hdr, records, pool);
+}
+
+// ===================================================================================
+// SPOOLER
+// ===================================================================================
+
+bool PackSpooler::begin(fs::FS& fs, const char* recordsPath, const char* poolPath) {
+    scratchFs = &fs;
+    this->recordsPath = recordsPath;
+    this->poolPath = poolPath;
+    itemCount = 0;
+    poolSize = 0;
+    records = fs.open(recordsPath, "w");
+    pool = fs.open(poolPath, "w");
+    ok = records && pool;
+    return ok;
+}
+
+uint32_t PackSpooler::add(const char* s) {
+    if (!s) s = "";
+    uint32_t ref = poolSize;
+    size_t len = strlen(s);
+    uint16_t len16 = len > PACK_MAX_STRING ? PACK_MAX_STRING : len;
+    ok = ok && pool.write((const uint8_t*)&len16, 2) == 2 &&
+         (len16 == 0 || pool.write((const uint8_t*)s, len16) == len16) &&
+         pool.write((uint8_t)0) == 1;
+    poolSize += 2 + len16 + 1;
+    return ref;
+}
+
+bool PackSpooler::addQuestion(const Question& q) {
+    if (!ok) return false;
+    PackQuestionRecord rec;
+    fillQuestionRecord(q, rec, *this);
+    ok = ok && records.write((const uint8_t*)&rec, sizeof(rec)) == sizeof(rec);
+    if (ok) itemCount++;
+    return ok;
+}
+
+static bool copyFile(File& from, File& to) {
+    uint8_t buf[512];
+    size_t n;
+    while ((n = from.read(buf, sizeof(buf))) > 0) {
+        if (to.write(buf, n) != n) return false;
+    }
+    return true;
+}
+
+bool PackSpooler::finish(File& out, const ExamData& exam) {
+    PackHeader hdr = makeHeader(PACK_EXAM, sizeof(PackQuestionRecord), itemCount);
+    hdr.idRef = add(exam.id);
+    hdr.titleRef = add(exam.title);
+    hdr.durationMinutes = exam.durationMinutes;
+    hdr.flags = exam.showResultsImmediate ? PACK_FLAG_SHOW_RESULTS : 0;
+    hdr.poolSize = poolSize;
+
+    bool written = ok && !records.getWriteError() && !pool.getWriteError();
+    records.close();
+    pool.close();
+    if (!written) return false;
+
+    // Header, then both scratch files back to back
+    File recordsIn = scratchFs->open(recordsPath, "r");
+    File poolIn = scratchFs->open(poolPath, "r");
+    written = recordsIn && poolIn && out.write((const uint8_t*)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+              copyFile(recordsIn, out) && copyFile(poolIn, out);
+    recordsIn.close();
+    poolIn.close();
+    return written;
+}
+
+void PackSpooler::discard() {
+    if (records) records.close();
+    if (pool) pool.close();
+    if (scratchFs) {
+        scratchFs->remove(recordsPath);
+        scratchFs->remove(poolPath);
+    }
+}
+
+// ===================================================================================
+// READER
+// ===================================================================================
+
+bool PackReader::checkHeader(size_t size) {
+    if (hdr.magic != PACK_MAGIC || hdr.version != PACK_VERSION) {
+        Serial.printf("[PACK] Bad header (magic %08x, version %u)\n", hdr.magic, hdr.version);
+        return false;
+    }
+
+    // Catches truncated writes and record layouts from a newer firmware
+    size_t minRecord = (hdr.kind == PACK_DECK) ? sizeof(PackCardRecord) : sizeof(PackQuestionRecord);
+    if (hdr.recordSize < minRecord ||
+        hdr.poolOffset < hdr.recordOffset + (uint64_t)hdr.recordSize * hdr.itemCount ||
+        (uint64_t)hdr.poolOffset + hdr.poolSize > size) {
+        Serial.println("[PACK] Truncated or inconsistent pack");
+        return false;
+    }
+    return true;
+}
+
+bool PackReader::open(File f, PackKind expectedKind) {
+    close();
+    if (!f) return false;
+
+    if (f.read((uint8_t*)&hdr, sizeof(hdr)) != sizeof(hdr)) return false;
+    if (hdr.kind != expectedKind) {
+        Serial.printf("[PACK] Wrong kind %u (expected %u)\n", hdr.kind, expectedKind);
+        return false;
+    }
+    if (!checkHeader(f.size())) return false;
+
+    file = f;
+    return true;
+}
+
+bool PackReader::openMapped(const uint8_t* data, size_t size, ContentPin&& mapPin, PackKind expectedKind) {
+    close();
+    if (!data || size < sizeof(hdr)) return false;
+
+    memcpy(&hdr, data, sizeof(hdr));
+    if (hdr.kind != expectedKind || !checkHeader(size)) {
+        hdr = {};
+        return false;
+    }
+
+    mapped = data;
+    mappedSize = size;
+    pin = std::move(mapPin);
+    return true;
+}
+
+void PackReader::close() {
+    if (file) file.close();
+    mapped = nullptr;
+    mappedSize = 0;
+    pin.release();
+    hdr = {};
+}
+
+bool PackReader::readRecord(uint32_t index, void* rec, size_t size) {
+    if (index >= hdr.itemCount) return false;
+    uint32_t at = hdr.recordOffset + index * hdr.recordSize;
+    if (mapped) {
+        memcpy(rec, mapped + at, size);
+        return true;
+    }
+    if (!file || !file.seek(at)) return false;
+    return file.read((uint8_t*)rec, size) == size;
+}
+
+bool PackReader::readCard(uint32_t index, PackCardRecord& rec) {
+    return hdr.kind == PACK_DECK && readRecord(index, &rec, sizeof(rec));
+}
+
+bool PackReader::readQuestion(uint32_t index, PackQuestionRecord& rec) {
+    return hdr.kind != PACK_DECK && readRecord(index, &rec, sizeof(rec));
+}
+
+const char* PackReader::stringView(uint32_t ref) {
+    if (!mapped || ref == PACK_NO_STRING || ref + 2 >= hdr.poolSize) return nullptr;
+    // Pool entries are [u16 length][bytes][NUL] - the bytes are a C string already
+    return (const char*)(mapped + hdr.poolOffset + ref + 2);
+}
+
+size_t PackReader::readString(uint32_t ref, char* buf, size_t bufSize) {
+    if (bufSize == 0) return 0;
+    buf[0] = '\0';
+    if (mapped) {
+        const char* view = stringView(ref);
+        if (!view) return 0;
+        strlcpy(buf, view, bufSize);
+        return strlen(buf);
+    }
+    if (!file || ref == PACK_NO_STRING || ref >= hdr.poolSize) return 0;
+
+    uint16_t len = 0;
+    if (!file.seek(hdr.poolOffset + ref) || file.read((uint8_t*)&len, 2) != 2) return 0;
+
+    size_t toRead = len < bufSize - 1 ? len : bufSize - 1;
+    size_t got = file.read((uint8_t*)buf, toRead);
+    buf[got] = '\0';
+    return got;
+}
+
+String PackReader::readString(uint32_t ref) {
+    String out;
+    if (mapped) {
+        const char* view = stringView(ref);
+        if (view) out = view;
+        return out;
+    }
+    if (!file || ref == PACK_NO_STRING || ref >= hdr.poolSize) return out;
+
+    uint16_t len = 0;
+    if (!file.seek(hdr.poolOffset + ref) || file.read((uint8_t*)&len, 2) != 2) return out;
+
+    // Read straight into the String's buffer - no temporary
+    if (!out.reserve(len)) return out;
+    char chunk[64];
+    while (len > 0) {
+        size_t n = file.read((uint8_t*)chunk, len < sizeof(chunk) ? len : sizeof(chunk));
+        if (n == 0) break;
+        out.concat(chunk, n);
+        len -= n;
+    }
+    return out;
+}
+
+const char* PackReader::readString(uint32_t ref, StringArena& arena) {
+    // Mapped text is used in place - nothing lands in the arena
+    if (mapped) {
+        const char* view = stringView(ref);
+        return view ? view : "";
+    }
+    if (!file || ref == PACK_NO_STRING || ref >= hdr.poolSize) return "";
+
+    uint16_t len = 0;
+    if (!file.seek(hdr.poolOffset + ref) || file.read((uint8_t*)&len, 2) != 2) return "";
+    if (len == 0) return "";
+
+    // Read straight into the arena - no temporary
+    char* out = arena.reserve(len);
+    if (!out) return "";
+    size_t got = file.read((uint8_t*)out, len);
+    out[got] = '\0';
+    return out;
+}
+
+bool PackReader::loadDeck(Deck& deck) {
+    if (!isOpen() || hdr.kind != PACK_DECK) return false;
+    deck.clear();
+    if (mapped) deck.pin = ContentPin(contentPartition);  // Its text points into the mapping
+    deck.id = readString(hdr.idRef);
+    deck.title = readString(hdr.titleRef);
+    deck.cards.reserve(hdr.itemCount);
+
+    for (uint32_t i = 0; i < hdr.itemCount; i++) {
+        PackCardRecord rec;
+        if (!readCard(i, rec)) return false;
+        Flashcard card;
+        card.front = readString(rec.frontRef, deck.text);
+        card.back = readString(rec.backRef, deck.text);
+        card.rating = 0;
+        deck.cards.push_back(card);
+    }
+    return true;
+}
+
+bool PackReader::loadQuestion(uint32_t index, Question& q, StringArena& arena) {
+    PackQuestionRecord rec;
+    if (!readQuestion(index, rec)) return false;
+    q = Question();
+    q.id = rec.id;
+    q.kind = (rec.type == PACK_Q_MCQ) ? QUESTION_MCQ : QUESTION_SHORT_ANSWER;
+    q.text = readString(rec.textRef, arena);
+    for (uint8_t o = 0; o < rec.optionCount && o < PACK_MAX_OPTIONS; o++) {
+        q.options[q.optionCount++] = readString(rec.optionRefs[o], arena);
+    }
+    q.correctOption = rec.correctOption;
+    if (q.kind == QUESTION_SHORT_ANSWER) q.correctText = readString(rec.correctTextRef, arena);
+    return true;
+}
+
+bool PackReader::loadQuiz(Quiz& quiz) {
+    if (!isOpen() || hdr.kind != PACK_QUIZ) return false;
+    quiz.clear();
+    if (mapped) quiz.pin = ContentPin(contentPartition);  // Its text points into the mapping
+    quiz.id = readString(hdr.idRef);
+    quiz.title = readString(hdr.titleRef);
+
+    quiz.questions.reserve(hdr.itemCount);
+    for (uint32_t i = 0; i < hdr.itemCount; i++) {
+        Question q;
+        if (!loadQuestion(i, q, quiz.text)) return false;
+        quiz.questions.push_back(q);
+    }
+    return true;
+}
+
+bool PackReader::loadExamInfo(ExamData& exam) {
+    if (!isOpen() || hdr.kind != PACK_EXAM) return false;
+    exam.id = readString(hdr.idRef);
+    exam.title = readString(hdr.titleRef);
+    exam.durationMinutes = hdr.durationMinutes;
+    exam.showResultsImmediate = (hdr.flags & PACK_FLAG_SHOW_RESULTS) != 0;
+    return true;
+}
@@ -0,0 +1,164 @@
+/**
+ * Content Pack - Compact binary on-flash format for decks, quizzes and exams
+ *
+ * Layout (little-endian):
+ *   PackHeader      fixed 40 bytes, magic "SEPK" + format version
+ *   record table    itemCount * recordSize bytes (one record per card/question)
+ *   string pool     per string: [u16 length][UTF-8 bytes][NUL]
+ *
+ * Records hold offsets into the string pool instead of the text itself, so
+ * card or question N is a single seek away and its text can be read into a
+ * caller-owned buffer without parsing (or allocating) anything else. Packs
+ * mirrored in the mapped content partition are read in place instead.
+ */
+
+#ifndef CONTENT_PACK_H
+#define CONTENT_PACK_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "NetworkManager.h"
+#include "ContentPartition.h"
+
+#define PACK_MAGIC          0x4B504553  // "SEPK"
+#define PACK_VERSION        2
+#define PACK_NO_STRING      0xFFFFFFFF
+#define PACK_MAX_OPTIONS    4
+static_assert(PACK_MAX_OPTIONS <= CONTENT_MAX_OPTIONS, "Pack option slots must fit the in-memory question");
+#define PACK_MAX_STRING     0xFFFF
+
+// Display buffer size for a single card face / question text
+#define PACK_TEXT_MAX       1024
+
+enum PackKind : uint8_t {
+    PACK_DECK = 1,
+    PACK_QUIZ = 2,
+    PACK_EXAM = 3
+};
+
+enum PackQuestionType : uint8_t {
+    PACK_Q_MCQ = 0,
+    PACK_Q_SHORT_ANSWER = 1
+};
+
+#define PACK_FLAG_SHOW_RESULTS  0x01
+
+struct __attribute__((packed)) PackHeader {
+    uint32_t magic;
+    uint8_t  version;
+    uint8_t  kind;              // PackKind
+    uint16_t recordSize;        // Bytes per record, lets readers skip unknown trailing fields
+    uint32_t itemCount;
+    uint32_t recordOffset;      // Absolute file offset of the record table
+    uint32_t poolOffset;        // Absolute file offset of the string pool
+    uint32_t poolSize;
+    uint32_t idRef;             // Pool refs for the content id and title
+    uint32_t titleRef;
+    uint16_t durationMinutes;   // Exams only
+    uint8_t  flags;             // PACK_FLAG_*
+    uint8_t  reserved[5];
+};
+
+struct __attribute__((packed)) PackCardRecord {
+    uint32_t frontRef;
+    uint32_t backRef;
+};
+
+struct __attribute__((packed)) PackQuestionRecord {
+    int32_t  id;
+    uint8_t  type;              // PackQuestionType
+    uint8_t  optionCount;
+    int8_t   correctOption;     // -1 when the answer is free text
+    uint8_t  reserved;
+    uint32_t textRef;
+    uint32_t optionRefs[PACK_MAX_OPTIONS];
+    uint32_t correctTextRef;    // Short-answer text, PACK_NO_STRING for MCQ
+};
+
+static_assert(sizeof(PackHeader) == 40, "PackHeader layout changed - bump PACK_VERSION");
+static_assert(sizeof(PackCardRecord) == 8, "PackCardRecord layout changed - bump PACK_VERSION");
+static_assert(sizeof(PackQuestionRecord) == 32, "PackQuestionRecord layout changed - bump PACK_VERSION");
+
+// Serializes content structs into pack files
+class PackWriter {
+public:
+    static bool writeDeck(File& f, const Deck& deck);
+    static bool writeQuiz(File& f, const Quiz& quiz);
+};
+
+// Builds an exam pack one question at a time as it streams in, so the exam
+// is never whole in RAM. Records and strings go to two scratch files that
+// finish() copies out behind the header.
+class PackSpooler {
+public:
+    bool begin(fs::FS& fs, const char* recordsPath, const char* poolPath);
+    bool addQuestion(const Question& q);   // False once any write has failed
+    bool finish(File& out, const ExamData& exam);
+    void discard();                        // Removes the scratch files
+
+    uint32_t count() const { return itemCount; }
+
+    // Appends one pool string, returns its ref
+    uint32_t add(const char* s);
+    uint32_t add(const String& s) { return add(s.c_str()); }
+
+private:
+    fs::FS* scratchFs = nullptr;
+    String recordsPath;
+    String poolPath;
+    File records;
+    File pool;
+    uint32_t itemCount = 0;
+    uint32_t poolSize = 0;
+    bool ok = false;
+};
+
+// Random access into an open pack file
+class PackReader {
+public:
+    ~PackReader() { close(); }
+
+    bool open(File file, PackKind expectedKind);
+    // Reads a pack in place from the mapped content partition
+    bool openMapped(const uint8_t* data, size_t size, ContentPin&& pin, PackKind expectedKind);
+    void close();
+    bool isOpen() { return file || mapped; }
+    bool isMapped() const { return mapped != nullptr; }
+
+    const PackHeader& header() const { return hdr; }
+    uint32_t count() const { return hdr.itemCount; }
+
+    bool readCard(uint32_t index, PackCardRecord& rec);
+    bool readQuestion(uint32_t index, PackQuestionRecord& rec);
+
+    // Copies a pool string into buf (always NUL-terminated, truncated to fit).
+    // Returns the number of bytes copied, 0 for PACK_NO_STRING.
+    size_t readString(uint32_t ref, char* buf, size_t bufSize);
+    String readString(uint32_t ref);
+    const char* readString(uint32_t ref, StringArena& arena);  // "" for PACK_NO_STRING
+
+    // Pool string in place (mapped packs only, nullptr otherwise) - stays
+    // valid while the pack is open or its pin is held
+    const char* stringView(uint32_t ref);
+
+    // Materialize the whole pack into the in-memory structs
+    bool loadDeck(Deck& deck);
+    bool loadQuiz(Quiz& quiz);
+
+    // One question, text read into `arena` (or viewed in place when mapped)
+    bool loadQuestion(uint32_t index, Question& q, StringArena& arena);
+    // Exam header fields only - questions are paged in by ExamWindow
+    bool loadExamInfo(ExamData& exam);
+
+private:
+    File file;
+    const uint8_t* mapped = nullptr;
+    size_t mappedSize = 0;
+    ContentPin pin;
+    PackHeader hdr = {};
+
+    bool checkHeader(size_t fileSize);
+    bool readRecord(uint32_t index, void* rec, size_t size);
+};
+
+#endif
@@ -0,0 +1,367 @@
+/**
+ * Content Parser Implementation
+ * Kept apart from the HTTP session so the host tests can run the exact
+ * parser the device does.
+ */
+
+#include "ContentParser.h"
+
+// ===================================================================================
+// PARSE FILTERS
+// ===================================================================================
+// Fields marked true are stored; everything else is skipped as it is read,
+// so document capacity and parse time follow the fields the device uses, not
+// what the backend sends. Each is built once on first use (function statics
+// are thread-safe).
+
+JsonVariantConst cardFilter() {
+    static const StaticJsonDocument<64> filter = [] {
+        StaticJsonDocument<64> f;
+        f["front"] = true;
+        f["back"] = true;
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
+}
+
+// Quiz and exam questions share one filter - each shape simply lacks the
+// other's answer field
+static void addQuestionFields(JsonObject f) {
+    f["id"] = true;
+    f["type"] = true;
+    f["text"] = true;
+    f["options"] = true;
+    f["correct_option"] = true;
+    f["correct_answer"] = true;
+}
+
+JsonVariantConst questionFilter() {
+    static const StaticJsonDocument<128> filter = [] {
+        StaticJsonDocument<128> f;
+        addQuestionFields(f.to<JsonObject>());
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
+}
+
+// Top-level fields of a MessagePack content object, besides its item array
+static JsonVariantConst contentFieldFilter() {
+    static const StaticJsonDocument<64> filter = [] {
+        StaticJsonDocument<64> f;
+        f["id"] = true;
+        f["title"] = true;
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
+}
+
+static JsonVariantConst examFieldFilter() {
+    static const StaticJsonDocument<128> filter = [] {
+        StaticJsonDocument<128> f;
+        f["id"] = true;
+        f["title"] = true;
+        f["duration_minutes"] = true;
+        f["show_results_immediate"] = true;
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
+}
+
+// ===================================================================================
+// STREAMING PARSERS
+// ===================================================================================
+// Bodies are walked by structure: the top-level object is read one member at
+// a time, scalar fields are kept, and the item array is deserialized one
+// element at a time into a small document that is reused for every item, so
+// peak heap is bounded by the largest single item. Field order does not
+// matter. FastAPI sends JSON bodies with Content-Length, so getStream() is
+// never chunk-encoded.
+
+// Stream::peek() does not wait for data - spin like Stream::timedRead() does
+static int timedPeek(Stream& stream) {
+    unsigned long start = millis();
+    do {
+        int c = stream.peek();
+        if (c >= 0) return c;
+        yield();
+    } while (millis() - start < stream.getTimeout());
+    return -1;
+}
+
+// Next significant character, left in the stream (-1 on timeout)
+static int peekToken(Stream& stream) {
+    int c = timedPeek(stream);
+    while (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+        stream.read();
+        c = timedPeek(stream);
+    }
+    return c;
+}
+
+static bool expectToken(Stream& stream, char expected) {
+    if (peekToken(stream) != expected) return false;
+    stream.read();
+    return true;
+}
+
+// A member name; longer names are truncated, which only means they match nothing
+static bool readJsonKey(Stream& stream, char* key, size_t size) {
+    if (!expectToken(stream, '"')) return false;
+    size_t len = 0;
+    for (;;) {
+        char c;
+        if (stream.readBytes(&c, 1) != 1) return false;
+        if (c == '"') break;
+        if (c == '\\' && stream.readBytes(&c, 1) != 1) return false;
+        if (len + 1 < size) key[len++] = c;
+    }
+    key[len] = '\0';
+    return true;
+}
+
+// Numbers are read here rather than by deserializeJson(): it has to read one
+// character past a number to find its end, which would swallow the separator.
+static bool readJsonNumber(Stream& stream, JsonDocument& doc) {
+    char buf[32];
+    size_t len = 0;
+    bool isFloat = false;
+    for (;;) {
+        int c = timedPeek(stream);
+        if (!(isdigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) break;
+        if (c == '.' || c == 'e' || c == 'E') isFloat = true;
+        if (len + 1 >= sizeof(buf)) return false;
+        buf[len++] = stream.read();
+    }
+    buf[len] = '\0';
+    if (len == 0) return false;
+    if (isFloat) doc.set(strtod(buf, nullptr));
+    else doc.set(strtoll(buf, nullptr, 10));
+    return true;
+}
+
+bool walkJsonArray(Stream& stream, DynamicJsonDocument& doc, JsonVariantConst filter, const JsonItemHandler& onItem) {
+    if (!expectToken(stream, '[')) return false;
+    if (peekToken(stream) == ']') {
+        stream.read();
+        return true;
+    }
+    for (;;) {
+        doc.clear();
+        DeserializationError error = deserializeJson(doc, stream, DeserializationOption::Filter(filter));
+        if (error) {
+            Serial.printf("[NET] Stream item parse error: %s\n", error.c_str());
+            return false;
+        }
+        onItem(doc.as<JsonObject>());
+
+        int c = peekToken(stream);
+        if (c != ',' && c != ']') return false;
+        stream.read();
+        if (c == ']') return true;
+    }
+}
+
+// Walks the top-level JSON object: the array under `arrayKey` goes item by
+// item to `onItem`, fields that `fieldFilter` names go to `onField`, and
+// anything else is read past without being stored.
+template <typename FieldHandler, typename ItemHandler>
+static bool walkJsonObject(Stream& stream, const char* arrayKey, DynamicJsonDocument& itemDoc,
+                           JsonVariantConst fieldFilter, JsonVariantConst itemFilter,
+                           FieldHandler onField, ItemHandler onItem) {
+    if (!expectToken(stream, '{')) return false;
+    if (peekToken(stream) == '}') {
+        stream.read();
+        return true;
+    }
+
+    DynamicJsonDocument field(STREAM_FIELD_DOC_SIZE);
+    char name[32];
+    for (;;) {
+        if (!readJsonKey(stream, name, sizeof(name)) || !expectToken(stream, ':')) return false;
+
+        if (strcmp(name, arrayKey) == 0) {
+            if (!walkJsonArray(stream, itemDoc, itemFilter, onItem)) return false;
+        } else {
+            JsonVariantConst allowed = fieldFilter[name];
+            field.clear();
+            int c = peekToken(stream);
+            if (c == '-' || isdigit(c)) {
+                if (!readJsonNumber(stream, field)) return false;
+            } else if (deserializeJson(field, stream, DeserializationOption::Filter(allowed))) {
+                return false;
+            }
+            if (allowed.as<bool>()) onField(name, field.as<JsonVariant>());
+        }
+
+        int c = peekToken(stream);
+        if (c != ',' && c != '}') return false;
+        stream.read();
+        if (c == '}') return true;
+    }
+}
+
+// MessagePack bodies carry their own lengths, so the top-level map is walked
+// by its entry count: scalar fields go to `onField`, and the array under
+// `arrayKey` is read one element at a time into `itemDoc`, as for JSON.
+
+static bool readMsgPackLength(Stream& stream, uint8_t fixPrefix, uint8_t code16, uint8_t code32, uint32_t& len) {
+    uint8_t b;
+    if (stream.readBytes(&b, 1) != 1) return false;
+    if ((b & 0xF0) == fixPrefix) {
+        len = b & 0x0F;
+        return true;
+    }
+    uint8_t buf[4];
+    size_t n = (b == code16) ? 2 : (b == code32) ? 4 : 0;
+    if (n == 0 || stream.readBytes(buf, n) != n) return false;
+    len = 0;
+    for (size_t i = 0; i < n; i++) len = (len << 8) | buf[i];
+    return true;
+}
+
+template <typename FieldHandler, typename ItemHandler>
+static bool walkMsgPackObject(Stream& stream, const char* arrayKey, DynamicJsonDocument& itemDoc,
+                              JsonVariantConst fieldFilter, JsonVariantConst itemFilter,
+                              FieldHandler onField, ItemHandler onItem) {
+    uint32_t entries;
+    if (!readMsgPackLength(stream, 0x80, 0xde, 0xdf, entries)) return false;
+
+    StaticJsonDocument<64> key;
+    DynamicJsonDocument field(STREAM_FIELD_DOC_SIZE);
+    for (uint32_t i = 0; i < entries; i++) {
+        if (deserializeMsgPack(key, stream)) return false;
+        const char* name = key.as<const char*>();
+        if (!name) name = "";
+
+        if (strcmp(name, arrayKey) == 0) {
+            uint32_t items;
+            if (!readMsgPackLength(stream, 0x90, 0xdc, 0xdd, items)) return false;
+            for (uint32_t j = 0; j < items; j++) {
+                itemDoc.clear();
+                DeserializationError error = deserializeMsgPack(itemDoc, stream, DeserializationOption::Filter(itemFilter));
+                if (error) {
+                    Serial.printf("[NET] MsgPack item parse error: %s\n", error.c_str());
+                    return false;
+                }
+                onItem(itemDoc.as<JsonObject>());
+            }
+            continue;
+        }
+
+        // Fields the filter does not name are read past without being stored
+        JsonVariantConst allowed = fieldFilter[name];
+        if (deserializeMsgPack(field, stream, DeserializationOption::Filter(allowed))) return false;
+        if (allowed.as<bool>()) onField(name, field.as<JsonVariant>());
+    }
+    return true;
+}
+
+// Item text is copied out of the (reused) item document into the content's arena
+static void readOptions(JsonArray opts, StringArena& arena, const char** options, uint8_t& count) {
+    count = 0;
+    for (JsonVariant opt : opts) {
+        if (count == CONTENT_MAX_OPTIONS) break;
+        options[count++] = arena.add(opt.as<const char*>());
+    }
+}
+
+static void readCard(JsonObject c, Deck& deck) {
+    Flashcard f;
+    f.front = deck.text.add(c["front"].as<const char*>());
+    f.back = deck.text.add(c["back"].as<const char*>());
+    f.rating = 0;
+    deck.cards.push_back(f);
+}
+
+int8_t resolveCorrectOption(const char* answer, const Question& q) {
+    if (!answer) return -1;
+    while (*answer == ' ') answer++;
+    if (!*answer) return -1;
+
+    // Index as served by the sample content
+    if (isdigit((unsigned char)answer[0]) && (answer[1] == '\0' || answer[1] == ')')) {
+        int idx = answer[0] - '0';
+        return idx < q.optionCount ? idx : -1;
+    }
+    // Letter as produced by the generator ("C" or "C) ...")
+    char letter = toupper((unsigned char)answer[0]);
+    if (letter >= 'A' && letter < 'A' + q.optionCount && (answer[1] == '\0' || answer[1] == ')')) {
+        return letter - 'A';
+    }
+    for (uint8_t i = 0; i < q.optionCount; i++) {
+        if (strcasecmp(answer, q.options[i]) == 0) return i;
+    }
+    return -1;
+}
+
+// Quiz questions carry "type" and "correct_answer", exam questions
+// "correct_option" - both end up in the same Question
+static Question readQuestion(JsonObject qObj, StringArena& arena) {
+    Question q;
+    q.id = qObj["id"];
+    const char* type = qObj["type"] | "mcq";
+    q.kind = (strcmp(type, "mcq") == 0) ? QUESTION_MCQ : QUESTION_SHORT_ANSWER;
+    q.text = arena.add(qObj["text"].as<const char*>());
+    readOptions(qObj["options"], arena, q.options, q.optionCount);
+
+    if (qObj.containsKey("correct_option")) {
+        q.correctOption = qObj["correct_option"] | -1;
+    } else if (q.kind == QUESTION_MCQ) {
+        q.correctOption = resolveCorrectOption(qObj["correct_answer"].as<const char*>(), q);
+    } else {
+        q.correctText = arena.add(qObj["correct_answer"].as<const char*>());
+    }
+    return q;
+}
+
+bool parseDeckStream(Stream& stream, Deck& deck, WireFormat format) {
+    DynamicJsonDocument doc(STREAM_CARD_DOC_SIZE);
+    auto onField = [&](const char* key, JsonVariant value) {
+        if (strcmp(key, "id") == 0) deck.id = value.as<String>();
+        else if (strcmp(key, "title") == 0) deck.title = value.as<String>();
+    };
+    auto onCard = [&](JsonObject c) { readCard(c, deck); };
+
+    if (format == WIRE_MSGPACK) {
+        return walkMsgPackObject(stream, "cards", doc, contentFieldFilter(), cardFilter(), onField, onCard);
+    }
+    return walkJsonObject(stream, "cards", doc, contentFieldFilter(), cardFilter(), onField, onCard);
+}
+
+bool parseQuizStream(Stream& stream, Quiz& quiz, WireFormat format) {
+    DynamicJsonDocument doc(STREAM_QUESTION_DOC_SIZE);
+    auto onField = [&](const char* key, JsonVariant value) {
+        if (strcmp(key, "id") == 0) quiz.id = value.as<String>();
+        else if (strcmp(key, "title") == 0) quiz.title = value.as<String>();
+    };
+    auto onQuestion = [&](JsonObject q) { quiz.questions.push_back(readQuestion(q, quiz.text)); };
+
+    if (format == WIRE_MSGPACK) {
+        return walkMsgPackObject(stream, "questions", doc, contentFieldFilter(), questionFilter(), onField, onQuestion);
+    }
+    return walkJsonObject(stream, "questions", doc, contentFieldFilter(), questionFilter(), onField, onQuestion);
+}
+
+// Exams are handed on one question at a time and never collected here - the
+// text lives in a small scratch arena that is reset between questions
+bool parseExamStream(Stream& stream, ExamData& exam, const QuestionSink& onQuestion, WireFormat format) {
+    exam = ExamData();  // Default 30 min, results shown, if the body omits them
+    DynamicJsonDocument doc(STREAM_QUESTION_DOC_SIZE);
+    StringArena scratch(EXAM_SCRATCH_ARENA_SIZE);
+    auto emit = [&](JsonObject q) {
+        onQuestion(readQuestion(q, scratch));
+        scratch.reset();
+    };
+
+    auto onField = [&](const char* key, JsonVariant value) {
+        if (strcmp(key, "id") == 0) exam.id = value.as<String>();
+        else if (strcmp(key, "title") == 0) exam.title = value.as<String>();
+        else if (strcmp(key, "duration_minutes") == 0) exam.durationMinutes = value | 30;
+        else if (strcmp(key, "show_results_immediate") == 0) exam.showResultsImmediate = value | true;
+    };
+
+    if (format == WIRE_MSGPACK) {
+        return walkMsgPackObject(stream, "questions", doc, examFieldFilter(), questionFilter(), onField, emit);
+    }
+    return walkJsonObject(stream, "questions", doc, examFieldFilter(), questionFilter(), onField, emit);
+}
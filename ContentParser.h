@@ -0,0 +1,33 @@
+/**
+ * Content Parser - Streaming readers for deck, quiz and exam bodies
+ * Bodies arrive as JSON or MessagePack and are read one card/question at a
+ * time from any Stream (HTTP body or file). Nothing here touches the
+ * network, so the host tests link it as is.
+ */
+
+#ifndef CONTENT_PARSER_H
+#define CONTENT_PARSER_H
+
+#include "NetworkManager.h"
+
+// Read in any field order. Return false if the body was truncated or
+// malformed; what was read so far is left in place.
+bool parseDeckStream(Stream& stream, Deck& deck, WireFormat format = WIRE_JSON);
+bool parseQuizStream(Stream& stream, Quiz& quiz, WireFormat format = WIRE_JSON);
+bool parseExamStream(Stream& stream, ExamData& exam, const QuestionSink& onQuestion,
+                     WireFormat format = WIRE_JSON);
+
+// Maps a backend answer ("2", "C", "C) ...", or the option text itself) to
+// an option index, -1 if it names none of them
+int8_t resolveCorrectOption(const char* answer, const Question& q);
+
+// Walks a JSON array, deserializing the fields of each element that `filter`
+// allows into `doc` and handing it to `onItem`. False if truncated/malformed.
+typedef std::function<void(JsonObject)> JsonItemHandler;
+bool walkJsonArray(Stream& stream, DynamicJsonDocument& doc, JsonVariantConst filter, const JsonItemHandler& onItem);
+
+// Per-item filters, applied to every card/question in either wire format
+JsonVariantConst cardFilter();
+JsonVariantConst questionFilter();
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * Content Partition Implementation
+ * Writes go through esp_partition_write/erase_range, which flush the flash
+ * cache for the range they touch, so the mapping never serves stale bytes.
+ */
+
+#include "ContentPartition.h"
+#include <esp_idf_version.h>
+
+// Global instance
+ContentPartition contentPartition;
+
+#define CPART_SLOTS  (CPART_INDEX_SIZE / sizeof(CPartEntry))
+
+static uint32_t alignUp(uint32_t v, uint32_t a) {
+    return (v + a - 1) & ~(a - 1);
+}
+
+// ===================================================================================
+// PINS
+// ===================================================================================
+
+ContentPin::ContentPin(ContentPartition& partition) : owner(&partition) {
+    owner->pins++;
+}
+
+ContentPin& ContentPin::operator=(ContentPin&& other) noexcept {
+    if (this != &other) {
+        release();
+        owner = other.owner;
+        other.owner = nullptr;
+    }
+    return *this;
+}
+
+void ContentPin::release() {
+    if (owner) {
+        owner->pins--;
+        owner = nullptr;
+    }
+}
+
+// ===================================================================================
+// PARTITION
+// ===================================================================================
+
+bool ContentPartition::begin() {
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                    (esp_partition_subtype_t)CONTENT_PARTITION_SUBTYPE,
+                                    CONTENT_PARTITION_LABEL);
+    if (!part) {
+        Serial.println("[CPART] No content partition - packs are read from LittleFS");
+        return false;
+    }
+
+    const void* ptr = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &ptr, &handle);
+#else
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle);
+#endif
+    if (err != ESP_OK) {
+        Serial.printf("[CPART] mmap failed: %s\n", esp_err_to_name(err));
+        return false;
+    }
+    lock = xSemaphoreCreateMutex();
+    base = (const uint8_t*)ptr;
+    mapHandle = handle;
+    mappedSize = part->size;
+
+    const CPartHeader* hdr = (const CPartHeader*)base;
+    if (hdr->magic != CPART_MAGIC || hdr->version != CPART_VERSION) {
+        Serial.println("[CPART] Formatting content partition");
+        if (!format()) return false;
+    } else {
+        loadIndex();
+    }
+
+    Serial.printf("[CPART] Mapped %u KB at %p: %d packs, %u bytes used\n",
+                  mappedSize / 1024, base, entries.size(), writeHead);
+    return true;
+}
+
+// Erases the index and starts over. Data sectors are erased lazily as
+// packs are written into them.
+bool ContentPartition::format() {
+    if (pins > 0) {
+        Serial.println("[CPART] Reset deferred - mapped content is in use");
+        return false;
+    }
+    if (esp_partition_erase_range(part, 0, CPART_INDEX_SIZE) != ESP_OK) return false;
+
+    CPartHeader hdr;
+    memset(&hdr, 0xFF, sizeof(hdr));
+    hdr.magic = CPART_MAGIC;
+    hdr.version = CPART_VERSION;
+    if (esp_partition_write(part, 0, &hdr, sizeof(hdr)) != ESP_OK) return false;
+
+    entries.clear();
+    nextSlot = 1;
+    writeHead = CPART_INDEX_SIZE;
+    erasedUpTo = CPART_INDEX_SIZE;
+    return true;
+}
+
+void ContentPartition::loadIndex() {
+    entries.clear();
+    writeHead = CPART_INDEX_SIZE;
+    nextSlot = CPART_SLOTS;
+
+    for (uint32_t i = 1; i < CPART_SLOTS; i++) {
+        const CPartEntry* e = (const CPartEntry*)(base + i * sizeof(CPartEntry));
+        if (e->kind == 0xFF && e->commit == 0xFFFFFFFF) {
+            nextSlot = i;
+            break;
+        }
+        if (e->commit != CPART_COMMIT) continue;  // Torn by a reset mid-write
+
+        String id;
+        id.concat(e->id, strnlen(e->id, CPART_ID_MAX));
+        setEntry(e->kind, id, e->offset, e->size);
+        if (e->offset && e->offset + e->size > writeHead) writeHead = e->offset + e->size;
+    }
+
+    // Everything past writeHead in its sector must still be erased; a torn
+    // pack may have left bytes there, in which case skip to the next sector
+    erasedUpTo = alignUp(writeHead, SPI_FLASH_SEC_SIZE);
+    for (uint32_t p = writeHead; p < erasedUpTo && p < mappedSize; p++) {
+        if (base[p] != 0xFF) {
+            writeHead = erasedUpTo;
+            break;
+        }
+    }
+}
+
+void ContentPartition::setEntry(uint8_t kind, const String& id, uint32_t offset, uint32_t size) {
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].kind == kind && entries[i].id == id) {
+            if (offset == 0) {
+                entries.erase(entries.begin() + i);
+            } else {
+                entries[i].offset = offset;
+                entries[i].size = size;
+            }
+            return;
+        }
+    }
+    if (offset) entries.push_back({kind, id, offset, size});
+}
+
+bool ContentPartition::eraseThrough(uint32_t end) {
+    if (end <= erasedUpTo) return true;
+    uint32_t to = alignUp(end, SPI_FLASH_SEC_SIZE);
+    if (esp_partition_erase_range(part, erasedUpTo, to - erasedUpTo) != ESP_OK) return false;
+    erasedUpTo = to;
+    return true;
+}
+
+bool ContentPartition::appendEntry(uint8_t kind, const String& id, uint32_t offset, uint32_t size) {
+    if (nextSlot >= CPART_SLOTS) return false;
+
+    CPartEntry e;
+    memset(&e, 0, sizeof(e));
+    e.kind = kind;
+    e.offset = offset;
+    e.size = size;
+    strlcpy(e.id, id.c_str(), sizeof(e.id));
+    e.commit = 0xFFFFFFFF;
+
+    // Body first, commit word last, so a reset in between leaves an ignored slot
+    uint32_t at = nextSlot * sizeof(CPartEntry);
+    nextSlot++;
+    if (esp_partition_write(part, at, &e, sizeof(e) - sizeof(e.commit)) != ESP_OK) return false;
+    uint32_t commit = CPART_COMMIT;
+    if (esp_partition_write(part, at + offsetof(CPartEntry, commit), &commit, sizeof(commit)) != ESP_OK) return false;
+
+    setEntry(kind, id, offset, size);
+    return true;
+}
+
+bool ContentPartition::store(uint8_t kind, const String& id, File& src) {
+    if (!isReady() || !src || id.length() >= CPART_ID_MAX) return false;
+    size_t size = src.size();
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t offset = alignUp(writeHead, CPART_ALIGN);
+    if (nextSlot >= CPART_SLOTS || offset + size > mappedSize) {
+        // Full - start over; packs not yet re-mirrored keep loading from LittleFS
+        if (!format()) {
+            xSemaphoreGive(lock);
+            return false;
+        }
+        offset = writeHead;
+        Serial.println("[CPART] Partition full - reset");
+    }
+    if (offset + size > mappedSize || !eraseThrough(offset + size)) {
+        xSemaphoreGive(lock);
+        return false;
+    }
+
+    bool ok = src.seek(0);
+    uint8_t buf[512];
+    uint32_t done = 0;
+    while (ok && done < size) {
+        size_t n = src.read(buf, size - done < sizeof(buf) ? size - done : sizeof(buf));
+        ok = n > 0 && esp_partition_write(part, offset + done, buf, n) == ESP_OK;
+        done += n;
+    }
+    // The bytes are spent either way - never write over them again
+    writeHead = offset + done;
+    ok = ok && appendEntry(kind, id, offset, size);
+    xSemaphoreGive(lock);
+
+    if (!ok) Serial.printf("[CPART] Mirror of %s failed\n", id.c_str());
+    return ok;
+}
+
+void ContentPartition::remove(uint8_t kind, const String& id) {
+    if (!isReady()) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (const auto& e : entries) {
+        if (e.kind == kind && e.id == id) {
+            // Without a free slot the in-RAM drop still holds for this boot;
+            // ContentStore also checks the size against LittleFS
+            if (!appendEntry(kind, id, 0, 0)) setEntry(kind, id, 0, 0);
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+}
+
+void ContentPartition::prune(uint8_t kind, const std::vector<String>& keepIds) {
+    if (!isReady()) return;
+    std::vector<String> stale;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (const auto& e : entries) {
+        if (e.kind != kind) continue;
+        bool kept = false;
+        for (const auto& id : keepIds) {
+            if (id == e.id) { kept = true; break; }
+        }
+        if (!kept) stale.push_back(e.id);
+    }
+    xSemaphoreGive(lock);
+    for (const auto& id : stale) remove(kind, id);
+}
+
+void ContentPartition::clear() {
+    if (!isReady()) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    format();
+    xSemaphoreGive(lock);
+}
+
+bool ContentPartition::find(uint8_t kind, const String& id, const uint8_t*& data, size_t& size, ContentPin& pin) {
+    if (!isReady()) return false;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool found = false;
+    for (const auto& e : entries) {
+        if (e.kind == kind && e.id == id) {
+            data = base + e.offset;
+            size = e.size;
+            pin = ContentPin(*this);  // Taken under the lock, so a reset cannot slip in
+            found = true;
+            break;
+        }
+    }
+    xSemaphoreGive(lock);
+    return found;
+}
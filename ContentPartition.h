@@ -0,0 +1,132 @@
+/**
+ * Content Partition - Memory-mapped mirror of cached packs
+ * A raw "content" data partition (see partitions.csv) holds a copy of every
+ * pack the ContentStore writes, and the whole partition is mapped into the
+ * data address space with esp_partition_mmap. A pack opened from here is
+ * read in place: record lookups are pointer arithmetic and pool strings are
+ * NUL-terminated already, so card and question text can go straight to LVGL
+ * labels with no RAM copy and no parse step.
+ *
+ * Layout: an index area of fixed 64-byte entries (appended, newest wins, a
+ * zero offset is a tombstone) followed by the packs, written sequentially.
+ * When either area fills up the partition is reset and refills as content
+ * is saved again; packs that are not mirrored are still read from LittleFS.
+ */
+
+#ifndef CONTENT_PARTITION_H
+#define CONTENT_PARTITION_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+#include <atomic>
+#include <esp_partition.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#define CONTENT_PARTITION_LABEL    "content"
+#define CONTENT_PARTITION_SUBTYPE  0x40
+
+#define CPART_MAGIC         0x54504553  // "SEPT"
+#define CPART_VERSION       1
+#define CPART_COMMIT        0xC0A1E5CE  // Written last - marks an entry complete
+#define CPART_INDEX_SIZE    8192        // Two sectors, 127 entries
+#define CPART_ID_MAX        48
+#define CPART_ALIGN         16
+
+struct __attribute__((packed)) CPartHeader {
+    uint32_t magic;
+    uint8_t  version;
+    uint8_t  reserved[59];
+};
+
+struct __attribute__((packed)) CPartEntry {
+    uint8_t  kind;              // PackKind, 0xFF = free slot
+    uint8_t  reserved[3];
+    uint32_t offset;            // From the partition start, 0 = removed
+    uint32_t size;
+    char     id[CPART_ID_MAX];
+    uint32_t commit;            // CPART_COMMIT once the pack and entry are written
+};
+
+static_assert(sizeof(CPartHeader) == 64, "CPartHeader must fill one index slot");
+static_assert(sizeof(CPartEntry) == 64, "CPartEntry layout changed - bump CPART_VERSION");
+
+class ContentPartition;
+
+// Keeps the partition from being reset while mapped text may still be read
+// (an open pack, or question/card views on screen). Move-only.
+class ContentPin {
+private:
+    ContentPartition* owner = nullptr;
+
+public:
+    ContentPin() = default;
+    explicit ContentPin(ContentPartition& partition);
+    ~ContentPin() { release(); }
+
+    ContentPin(const ContentPin&) = delete;
+    ContentPin& operator=(const ContentPin&) = delete;
+    ContentPin(ContentPin&& other) noexcept : owner(other.owner) { other.owner = nullptr; }
+    ContentPin& operator=(ContentPin&& other) noexcept;
+
+    void release();
+    bool held() const { return owner != nullptr; }
+};
+
+class ContentPartition {
+public:
+    bool begin();
+    bool isReady() const { return base != nullptr; }
+
+    // Mirrors a committed pack file. Fails (harmlessly) when full and pinned.
+    bool store(uint8_t kind, const String& id, File& src);
+    void remove(uint8_t kind, const String& id);
+    void prune(uint8_t kind, const std::vector<String>& keepIds);
+    void clear();
+
+    // Mapped bytes of a mirrored pack; `pin` keeps them valid
+    bool find(uint8_t kind, const String& id, const uint8_t*& data, size_t& size, ContentPin& pin);
+
+    // True when `p` points into the mapping - such text can be shown without a copy
+    bool contains(const void* p) const {
+        return base && (const uint8_t*)p >= base && (const uint8_t*)p < base + mappedSize;
+    }
+
+    size_t usedBytes() const { return writeHead; }
+    size_t totalBytes() const { return mappedSize; }
+
+private:
+    friend class ContentPin;
+
+    struct Entry {
+        uint8_t kind;
+        String id;
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    const esp_partition_t* part = nullptr;
+    const uint8_t* base = nullptr;
+    size_t mappedSize = 0;
+    uint32_t mapHandle = 0;
+
+    std::vector<Entry> entries;   // Live packs only
+    uint32_t nextSlot = 0;        // Next free index slot
+    uint32_t writeHead = CPART_INDEX_SIZE;
+    uint32_t erasedUpTo = CPART_INDEX_SIZE;
+    std::atomic<int> pins{0};
+
+    SemaphoreHandle_t lock = nullptr;   // Guards `entries` - stores run on the network worker
+
+    bool format();
+    void loadIndex();
+    bool appendEntry(uint8_t kind, const String& id, uint32_t offset, uint32_t size);
+    bool eraseThrough(uint32_t end);
+    void setEntry(uint8_t kind, const String& id, uint32_t offset, uint32_t size);
+};
+
+// Global instance
+extern ContentPartition contentPartition;
+
+#endif
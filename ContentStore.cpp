@@ -0,0 +1,391 @@
+/**
+ * Content Store Implementation
+ * Full content is kept as binary packs (see ContentPack.h) so opening a
+ * deck, quiz or exam never re-parses JSON. Catalog lists stay small JSON.
+ */
+
+#include "ContentStore.h"
+#include <ArduinoJson.h>
+
+// Global instance
+ContentStore contentStore;
+
+static const char* EXAM_DIR = "/exams";
+static const char* DECK_DIR = "/decks";
+static const char* QUIZ_DIR = "/quizzes";
+static const char* EXAM_LIST_PATH = "/exams.idx";
+static const char* DECK_LIST_PATH = "/decks.idx";
+static const char* QUIZ_LIST_PATH = "/quizzes.idx";
+static const char* SPOOL_RECORDS_PATH = "/spool.rec";
+static const char* SPOOL_POOL_PATH = "/spool.str";
+static const char* PACK_EXT = ".sep";
+static const char* ETAG_EXT = ".etag";
+
+bool ContentStore::begin() {
+    // Format on first boot (or after a partition change)
+    mounted = LittleFS.begin(true);
+    if (!mounted) {
+        Serial.println("[STORE] LittleFS mount failed - content cache disabled");
+        return false;
+    }
+
+    const char* dirs[] = {EXAM_DIR, DECK_DIR, QUIZ_DIR};
+    for (const char* dir : dirs) {
+        if (!LittleFS.exists(dir)) LittleFS.mkdir(dir);
+    }
+    removeLegacyJson();
+
+    Serial.printf("[STORE] Mounted: %u / %u bytes used\n", LittleFS.usedBytes(), LittleFS.totalBytes());
+    contentPartition.begin();
+    return true;
+}
+
+// Caches written before the pack format stored full content as .json
+void ContentStore::removeLegacyJson() {
+    const char* dirs[] = {EXAM_DIR, DECK_DIR, QUIZ_DIR};
+    for (const char* dir : dirs) {
+        File root = LittleFS.open(dir);
+        std::vector<String> stale;
+        File entry = root.openNextFile();
+        while (entry) {
+            String name = entry.name();
+            if (name.endsWith(".json")) stale.push_back(String(dir) + "/" + name);
+            entry = root.openNextFile();
+        }
+        for (const auto& p : stale) LittleFS.remove(p);
+        if (!stale.empty()) Serial.printf("[STORE] Removed %d legacy JSON files from %s\n", stale.size(), dir);
+    }
+}
+
+// Backend ids are free-form - keep file names short and path-safe
+String ContentStore::pathFor(const char* dir, const String& id, const char* ext) {
+    String safe;
+    for (size_t i = 0; i < id.length() && safe.length() < 40; i++) {
+        char c = id[i];
+        bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+        safe += ok ? c : '_';
+    }
+    if (id.length() > 40) {
+        // Disambiguate truncated ids with a short hash of the full id
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < id.length(); i++) hash = (hash ^ (uint8_t)id[i]) * 16777619u;
+        char suffix[10];
+        snprintf(suffix, sizeof(suffix), "~%08x", hash);
+        safe += suffix;
+    }
+    return String(dir) + "/" + safe + ext;
+}
+
+// Writes go to a temp file first so a power cut never leaves half a deck
+bool ContentStore::commitFile(const String& tmpPath, const String& path) {
+    if (LittleFS.exists(path)) LittleFS.remove(path);
+    if (!LittleFS.rename(tmpPath, path)) {
+        Serial.printf("[STORE] Rename failed: %s\n", path.c_str());
+        LittleFS.remove(tmpPath);
+        return false;
+    }
+    return true;
+}
+
+// ===================================================================================
+// CATALOG LISTS
+// ===================================================================================
+
+// Lists are written and read one entry at a time, so memory stays flat
+// however large the catalog grows
+bool ContentStore::saveList(const char* path, const std::vector<String>& ids, const std::vector<String>& titles) {
+    if (!mounted) return false;
+
+    String tmpPath = String(path) + ".tmp";
+    File f = LittleFS.open(tmpPath, "w");
+    if (!f) return false;
+
+    f.print('[');
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (i > 0) f.print(',');
+        StaticJsonDocument<64> entry;  // Holds pointers only - strings are not copied
+        entry["id"] = ids[i].c_str();
+        entry["title"] = titles[i].c_str();
+        serializeJson(entry, f);
+    }
+    f.print(']');
+    bool ok = !f.getWriteError();
+    f.close();
+
+    if (!ok) {
+        LittleFS.remove(tmpPath);
+        return false;
+    }
+    return commitFile(tmpPath, path);
+}
+
+template <typename Handler>
+void ContentStore::loadList(const char* path, Handler onItem) {
+    if (!mounted || !LittleFS.exists(path)) return;
+
+    File f = LittleFS.open(path, "r");
+    if (!f) return;
+
+    if (!f.find("[")) {
+        f.close();
+        return;
+    }
+    if (f.peek() == ']') {
+        f.close();
+        return;
+    }
+
+    StaticJsonDocument<LIST_ENTRY_DOC_SIZE> doc;
+    do {
+        DeserializationError error = deserializeJson(doc, f);
+        if (error) {
+            Serial.printf("[STORE] Corrupt list %s: %s\n", path, error.c_str());
+            break;
+        }
+        onItem(doc["id"].as<String>(), doc["title"].as<String>());
+    } while (f.findUntil(",", "]"));
+    f.close();
+}
+
+static const char* listPathFor(ContentKind kind) {
+    switch (kind) {
+        case CONTENT_EXAM: return EXAM_LIST_PATH;
+        case CONTENT_DECK: return DECK_LIST_PATH;
+        case CONTENT_QUIZ: return QUIZ_LIST_PATH;
+    }
+    return EXAM_LIST_PATH;
+}
+
+bool ContentStore::saveCatalog(ContentKind kind, const std::vector<ExamMetadata>& items) {
+    std::vector<String> ids, titles;
+    for (const auto& item : items) { ids.push_back(item.id); titles.push_back(item.title); }
+    return saveList(listPathFor(kind), ids, titles);
+}
+
+std::vector<ExamMetadata> ContentStore::loadCatalog(ContentKind kind) {
+    std::vector<ExamMetadata> items;
+    loadList(listPathFor(kind), [&](const String& id, const String& title) {
+        items.push_back({id, title});
+    });
+    return items;
+}
+
+// ===================================================================================
+// FULL CONTENT
+// ===================================================================================
+
+// Packs are written to a temp file and renamed, like the lists
+template <typename WriteFn>
+bool ContentStore::savePack(const char* dir, PackKind kind, const String& id, WriteFn writeFn) {
+    if (!mounted || id.length() == 0) return false;
+
+    String path = pathFor(dir, id, PACK_EXT);
+    String tmpPath = path + ".tmp";
+    File f = LittleFS.open(tmpPath, "w");
+    if (!f) return false;
+    bool ok = writeFn(f) && !f.getWriteError();
+    f.close();
+
+    if (!ok) {
+        Serial.printf("[STORE] Pack write failed for %s (flash full?)\n", id.c_str());
+        LittleFS.remove(tmpPath);
+        return false;
+    }
+    if (!commitFile(tmpPath, path)) return false;
+
+    // LittleFS stays the source of truth; the mapped mirror is best effort
+    File packFile = LittleFS.open(path, "r");
+    if (!contentPartition.store(kind, id, packFile)) contentPartition.remove(kind, id);
+    packFile.close();
+    return true;
+}
+
+bool ContentStore::openPack(const char* dir, const String& id, PackKind kind, PackReader& pack) {
+    String path = pathFor(dir, id, PACK_EXT);
+    if (!mounted || !LittleFS.exists(path)) return false;
+
+    // Mirrored in the content partition - read it in place. The size check
+    // guards against a mirror entry that outlived its LittleFS pack.
+    const uint8_t* data;
+    size_t size;
+    ContentPin pin;
+    if (contentPartition.find(kind, id, data, size, pin)) {
+        File f = LittleFS.open(path, "r");
+        bool current = f && f.size() == size;
+        f.close();
+        if (current && pack.openMapped(data, size, std::move(pin), kind)) return true;
+        contentPartition.remove(kind, id);
+    }
+
+    if (!pack.open(LittleFS.open(path, "r"), kind)) {
+        // Old format or torn write - drop it (and its validator) so the next open re-downloads
+        Serial.printf("[STORE] Cached pack %s unreadable, dropping\n", path.c_str());
+        pack.close();
+        LittleFS.remove(path);
+        LittleFS.remove(pathFor(dir, id, ETAG_EXT));
+        contentPartition.remove(kind, id);
+        return false;
+    }
+    return true;
+}
+
+bool ContentStore::spoolExam(const String& examId, const std::function<bool(PackSpooler&, ExamData&)>& fill) {
+    if (!mounted || examId.length() == 0) return false;
+
+    // Scratch files sit outside the pack dirs so prune() never sees them; a
+    // spool torn by a reset is simply overwritten by the next one
+    PackSpooler spool;
+    ExamData exam;
+    bool ok = spool.begin(LittleFS, SPOOL_RECORDS_PATH, SPOOL_POOL_PATH) && fill(spool, exam);
+    if (ok) {
+        if (exam.id.length() == 0) exam.id = examId;
+        ok = savePack(EXAM_DIR, PACK_EXAM, examId, [&](File& f) { return spool.finish(f, exam); });
+    }
+    spool.discard();
+    if (ok) Serial.printf("[STORE] Exam %s spooled: %u questions\n", examId.c_str(), spool.count());
+    return ok;
+}
+
+bool ContentStore::saveDeck(const Deck& deck) {
+    return savePack(DECK_DIR, PACK_DECK, deck.id, [&](File& f) { return PackWriter::writeDeck(f, deck); });
+}
+
+bool ContentStore::saveQuiz(const Quiz& quiz) {
+    return savePack(QUIZ_DIR, PACK_QUIZ, quiz.id, [&](File& f) { return PackWriter::writeQuiz(f, quiz); });
+}
+
+bool ContentStore::openExam(const String& examId, PackReader& pack) {
+    return openPack(EXAM_DIR, examId, PACK_EXAM, pack);
+}
+
+bool ContentStore::openDeck(const String& deckId, PackReader& pack) {
+    return openPack(DECK_DIR, deckId, PACK_DECK, pack);
+}
+
+bool ContentStore::openQuiz(const String& quizId, PackReader& pack) {
+    return openPack(QUIZ_DIR, quizId, PACK_QUIZ, pack);
+}
+
+bool ContentStore::loadDeck(const String& deckId, Deck& deck) {
+    unsigned long t0 = millis();
+    PackReader pack;
+    if (!openDeck(deckId, pack)) return false;
+    if (!pack.loadDeck(deck) || deck.cards.empty()) {
+        deck.clear();
+        return false;
+    }
+    Serial.printf("[STORE] Deck %s opened from flash in %lu ms (%u B text in %u blocks)\n",
+                  deckId.c_str(), millis() - t0, deck.text.used(), deck.text.blocks());
+    return true;
+}
+
+bool ContentStore::loadQuiz(const String& quizId, Quiz& quiz) {
+    unsigned long t0 = millis();
+    PackReader pack;
+    if (!openQuiz(quizId, pack)) return false;
+    if (!pack.loadQuiz(quiz) || quiz.questions.empty()) {
+        quiz.clear();
+        return false;
+    }
+    Serial.printf("[STORE] Quiz %s opened from flash in %lu ms (%u B text in %u blocks)\n",
+                  quizId.c_str(), millis() - t0, quiz.text.used(), quiz.text.blocks());
+    return true;
+}
+
+// ===================================================================================
+// VALIDATORS
+// ===================================================================================
+
+String ContentStore::dataPathFor(ContentKind kind, const String& id) {
+    switch (kind) {
+        case CONTENT_EXAM: return id.length() ? pathFor(EXAM_DIR, id, PACK_EXT) : String(EXAM_LIST_PATH);
+        case CONTENT_DECK: return id.length() ? pathFor(DECK_DIR, id, PACK_EXT) : String(DECK_LIST_PATH);
+        case CONTENT_QUIZ: return id.length() ? pathFor(QUIZ_DIR, id, PACK_EXT) : String(QUIZ_LIST_PATH);
+    }
+    return "";
+}
+
+// "/decks/abc.sep" -> "/decks/abc.etag", "/decks.idx" -> "/decks.etag"
+static String etagPathFor(const String& dataPath) {
+    return dataPath.substring(0, dataPath.lastIndexOf('.')) + ETAG_EXT;
+}
+
+String ContentStore::loadEtag(ContentKind kind, const String& id) {
+    String dataPath = dataPathFor(kind, id);
+    String path = etagPathFor(dataPath);
+    if (!mounted || !LittleFS.exists(dataPath) || !LittleFS.exists(path)) return "";
+
+    File f = LittleFS.open(path, "r");
+    if (!f) return "";
+    String etag = f.readString();
+    f.close();
+    etag.trim();
+    return etag;
+}
+
+void ContentStore::saveEtag(ContentKind kind, const String& id, const String& etag) {
+    if (!mounted) return;
+    String path = etagPathFor(dataPathFor(kind, id));
+    if (etag.length() == 0) {
+        LittleFS.remove(path);
+        return;
+    }
+
+    File f = LittleFS.open(path, "w");
+    if (!f) return;
+    f.print(etag);
+    f.close();
+}
+
+void ContentStore::prune(ContentKind kind, const std::vector<String>& keepIds) {
+    if (!mounted) return;
+    const char* dir = (kind == CONTENT_EXAM) ? EXAM_DIR : (kind == CONTENT_DECK) ? DECK_DIR : QUIZ_DIR;
+
+    // File names are derived from ids, so compare against the derived names
+    std::vector<String> keep;
+    for (const auto& id : keepIds) {
+        keep.push_back(pathFor(dir, id, PACK_EXT));
+        keep.push_back(pathFor(dir, id, ETAG_EXT));
+    }
+
+    File root = LittleFS.open(dir);
+    std::vector<String> stale;
+    File entry = root.openNextFile();
+    while (entry) {
+        String path = String(dir) + "/" + entry.name();
+        bool kept = false;
+        for (const auto& k : keep) {
+            if (k == path) { kept = true; break; }
+        }
+        if (!kept) stale.push_back(path);
+        entry = root.openNextFile();
+    }
+    for (const auto& p : stale) LittleFS.remove(p);
+    if (!stale.empty()) Serial.printf("[STORE] Pruned %d stale files from %s\n", stale.size(), dir);
+
+    PackKind packKind = (kind == CONTENT_EXAM) ? PACK_EXAM : (kind == CONTENT_DECK) ? PACK_DECK : PACK_QUIZ;
+    contentPartition.prune(packKind, keepIds);
+}
+
+void ContentStore::clear() {
+    if (!mounted) return;
+    const char* dirs[] = {EXAM_DIR, DECK_DIR, QUIZ_DIR};
+    for (const char* dir : dirs) {
+        File root = LittleFS.open(dir);
+        std::vector<String> paths;
+        File entry = root.openNextFile();
+        while (entry) {
+            paths.push_back(String(dir) + "/" + entry.name());
+            entry = root.openNextFile();
+        }
+        for (const auto& p : paths) LittleFS.remove(p);
+    }
+    LittleFS.remove(EXAM_LIST_PATH);
+    LittleFS.remove(DECK_LIST_PATH);
+    LittleFS.remove(QUIZ_LIST_PATH);
+    LittleFS.remove(etagPathFor(EXAM_LIST_PATH));
+    LittleFS.remove(etagPathFor(DECK_LIST_PATH));
+    LittleFS.remove(etagPathFor(QUIZ_LIST_PATH));
+    contentPartition.clear();
+    Serial.println("[STORE] Content cache cleared");
+}
@@ -0,0 +1,68 @@
+/**
+ * Content Store - On-device cache of study content on LittleFS
+ * Exams, quizzes and decks are written here whenever a download succeeds,
+ * and engines read from here first so content opens instantly and offline.
+ */
+
+#ifndef CONTENT_STORE_H
+#define CONTENT_STORE_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+#include <vector>
+#include "NetworkManager.h"
+#include "ContentPack.h"
+
+#define LIST_ENTRY_DOC_SIZE  384   // One { id, title } list entry
+
+class ContentStore {
+public:
+    bool begin();
+    bool isReady() { return mounted; }
+
+    // Catalog lists (id + title), used when the backend is unreachable
+    bool saveCatalog(ContentKind kind, const std::vector<ExamMetadata>& items);
+    std::vector<ExamMetadata> loadCatalog(ContentKind kind);
+
+    // Full content, stored as binary packs. Exams are never whole in RAM:
+    // `fill` streams questions into the spooler and sets the header fields.
+    bool spoolExam(const String& examId, const std::function<bool(PackSpooler&, ExamData&)>& fill);
+    bool saveDeck(const Deck& deck);
+    bool loadDeck(const String& deckId, Deck& deck);
+    bool saveQuiz(const Quiz& quiz);
+    bool loadQuiz(const String& quizId, Quiz& quiz);
+
+    // Random access to a cached pack without loading it into RAM
+    bool openExam(const String& examId, PackReader& pack);
+    bool openDeck(const String& deckId, PackReader& pack);
+    bool openQuiz(const String& quizId, PackReader& pack);
+
+    // HTTP validators, stored as sidecar files next to the cached data.
+    // loadEtag returns "" when the data itself is missing, so a 304 always
+    // has something to fall back on. An empty id means the catalog list.
+    String loadEtag(ContentKind kind, const String& id);
+    void saveEtag(ContentKind kind, const String& id, const String& etag);
+
+    // Deletes cached packs of `kind` whose id is not in keepIds
+    void prune(ContentKind kind, const std::vector<String>& keepIds);
+
+    void clear();
+
+private:
+    bool mounted = false;
+
+    String pathFor(const char* dir, const String& id, const char* ext);
+    bool commitFile(const String& tmpPath, const String& path);
+    bool saveList(const char* path, const std::vector<String>& ids, const std::vector<String>& titles);
+    template <typename Handler> void loadList(const char* path, Handler onItem);
+    template <typename WriteFn> bool savePack(const char* dir, PackKind kind, const String& id, WriteFn writeFn);
+    bool openPack(const char* dir, const String& id, PackKind kind, PackReader& pack);
+    void removeLegacyJson();
+    String dataPathFor(ContentKind kind, const String& id);
+};
+
+// Global instance
+extern ContentStore contentStore;
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * Content Sync Implementation
+ */
+
+#include "ContentSync.h"
+#include "ContentStore.h"
+
+ContentSync::ContentSync(SENetworkManager* nm) : netMgr(nm) {}
+
+void ContentSync::start() {
+    if (!contentStore.isReady() || !netMgr->isConnected()) {
+        Serial.println("[SYNC] Skipped - no WiFi or no content store");
+        return;
+    }
+    if (!lock) lock = xSemaphoreCreateMutex();
+    state = SYNC_MANIFEST;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    pending.clear();
+    nextItem = 0;
+    xSemaphoreGive(lock);
+    bytesDownloaded = 0;
+    failedItems = 0;
+    startTime = millis();
+}
+
+void ContentSync::update() {
+    // One step in flight at a time; the worker advances `state`
+    if (stepJob && !netMgr->isJobDone(stepJob)) return;
+    stepJob = 0;
+
+    switch (state) {
+        case SYNC_MANIFEST:
+            stepJob = netMgr->submitJob([this]() { fetchManifest(); });
+            break;
+        case SYNC_ITEMS:
+            stepJob = netMgr->submitJob([this]() { fetchNextItem(); });
+            break;
+        default:
+            break;
+    }
+}
+
+int ContentSync::getPendingCount() {
+    if (!lock) return 0;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    int count = pending.size() - nextItem;
+    xSemaphoreGive(lock);
+    return count;
+}
+
+void ContentSync::queueChanged(ContentKind kind, const std::vector<ManifestEntry>& entries,
+                               std::vector<PendingItem>& changed) {
+    std::vector<String> ids;
+    for (const auto& e : entries) {
+        ids.push_back(e.id);
+        // Stored ETag doubles as the cached version
+        if (contentStore.loadEtag(kind, e.id) != e.version) {
+            changed.push_back({kind, e.id, e.size});
+        }
+    }
+    // Items deleted on the backend should not linger offline
+    contentStore.prune(kind, ids);
+}
+
+void ContentSync::fetchManifest() {
+    Manifest manifest;
+    if (!netMgr->fetchManifest(manifest)) {
+        Serial.println("[SYNC] Manifest unavailable - content will be fetched per mode");
+        state = SYNC_FAILED;
+        return;
+    }
+
+    // Catalog lists come straight from the manifest. Their old list ETags
+    // described a different body, so drop them rather than risk a false 304.
+    const ContentKind kinds[] = {CONTENT_EXAM, CONTENT_DECK, CONTENT_QUIZ};
+    const std::vector<ManifestEntry>* lists[] = {&manifest.exams, &manifest.decks, &manifest.quizzes};
+    for (int k = 0; k < 3; k++) {
+        std::vector<ExamMetadata> items;
+        for (const auto& e : *lists[k]) items.push_back({e.id, e.title});
+        contentStore.saveCatalog(kinds[k], items);
+        contentStore.saveEtag(kinds[k], "", "");
+    }
+
+    std::vector<PendingItem> changed;
+    queueChanged(CONTENT_EXAM, manifest.exams, changed);
+    queueChanged(CONTENT_DECK, manifest.decks, changed);
+    queueChanged(CONTENT_QUIZ, manifest.quizzes, changed);
+
+    int total = manifest.exams.size() + manifest.decks.size() + manifest.quizzes.size();
+    Serial.printf("[SYNC] Manifest: %d items, %d changed\n", total, changed.size());
+    bool upToDate = changed.empty();
+    xSemaphoreTake(lock, portMAX_DELAY);
+    pending = std::move(changed);
+    nextItem = 0;
+    xSemaphoreGive(lock);
+
+    state = upToDate ? SYNC_DONE : SYNC_ITEMS;
+    if (state == SYNC_DONE) {
+        Serial.printf("[SYNC] Up to date in %lu ms\n", millis() - startTime);
+    }
+}
+
+void ContentSync::fetchNextItem() {
+    if (!netMgr->isConnected()) {
+        Serial.println("[SYNC] WiFi lost - stopping");
+        state = SYNC_FAILED;
+        return;
+    }
+
+    // Copied out so the download runs without the lock held
+    xSemaphoreTake(lock, portMAX_DELAY);
+    PendingItem item = pending[nextItem];
+    xSemaphoreGive(lock);
+
+    bool ok = false;
+    switch (item.kind) {
+        case CONTENT_EXAM:
+            ok = netMgr->syncExam(item.id);
+            break;
+        case CONTENT_DECK:
+            ok = netMgr->syncDeck(item.id);
+            break;
+        case CONTENT_QUIZ:
+            ok = !netMgr->fetchQuiz(item.id).questions.empty();
+            break;
+    }
+
+    if (ok) {
+        bytesDownloaded += item.size;
+    } else {
+        failedItems++;
+        Serial.printf("[SYNC] Failed: %s\n", item.id.c_str());
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    nextItem++;
+    size_t itemCount = pending.size();
+    bool finished = nextItem >= itemCount;
+    if (finished) {
+        pending.clear();
+        nextItem = 0;
+    }
+    xSemaphoreGive(lock);
+
+    if (finished) {
+        Serial.printf("[SYNC] Done: %d items (%lu bytes), %d failed, %lu ms\n",
+                      itemCount, bytesDownloaded, failedItems, millis() - startTime);
+        // Anything that failed is missing from the store - keep per-mode fetches on
+        state = failedItems ? SYNC_FAILED : SYNC_DONE;
+    }
+}
@@ -0,0 +1,67 @@
+/**
+ * Content Sync - Boot-time sync of all study content into the ContentStore
+ * Pulls GET /manifest once after WiFi connects, then downloads only the
+ * items whose version differs from the cached copy. Each step is one job on
+ * the network worker, so the main loop (and the menu) never waits on it.
+ */
+
+#ifndef CONTENT_SYNC_H
+#define CONTENT_SYNC_H
+
+#include <Arduino.h>
+#include <vector>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "NetworkManager.h"
+
+enum SyncState {
+    SYNC_IDLE,       // Not started (no WiFi at boot)
+    SYNC_MANIFEST,   // Waiting to fetch the manifest
+    SYNC_ITEMS,      // Downloading changed items
+    SYNC_DONE,       // Store matches the backend for this session
+    SYNC_FAILED      // Manifest unavailable - engines fall back to per-mode fetches
+};
+
+class ContentSync {
+private:
+    struct PendingItem {
+        ContentKind kind;
+        String id;
+        uint32_t size;
+    };
+
+    SENetworkManager* netMgr;
+    volatile SyncState state = SYNC_IDLE;  // Advanced by worker jobs
+    NetJobId stepJob = 0;
+
+    // Filled and consumed by worker jobs, counted from the main loop
+    SemaphoreHandle_t lock = nullptr;
+    std::vector<PendingItem> pending;
+    size_t nextItem = 0;
+
+    unsigned long startTime = 0;
+    uint32_t bytesDownloaded = 0;
+    int failedItems = 0;
+
+    void fetchManifest();
+    void fetchNextItem();
+    void queueChanged(ContentKind kind, const std::vector<ManifestEntry>& entries,
+                      std::vector<PendingItem>& changed);
+
+public:
+    ContentSync(SENetworkManager* nm);
+
+    void start();    // Call once WiFi is up
+    void update();   // Submits the next step once the previous one finished
+
+    // True once every item in the manifest is cached - engines can then
+    // skip the network entirely for the rest of the session
+    bool isSynced() { return state == SYNC_DONE; }
+    bool isRunning() { return state == SYNC_MANIFEST || state == SYNC_ITEMS; }
+    SyncState getState() { return state; }
+    int getPendingCount();
+};
+
+extern ContentSync contentSync;
+
+#endif
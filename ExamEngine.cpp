@@ -5,6 +5,9 @@
 
 #include "ExamEngine.h"
 #include "UIManager.h"
+#include "ContentStore.h"
+#include "ContentSync.h"
+#include "ResultQueue.h"
 #include <lvgl.h>
 
 // External feedback functions from main sketch
@@ -41,24 +44,39 @@ void ExamEngine::reset() {
     overviewScrollOffset = 0;
     cursorVisible = true;
     lastCursorBlink = 0;
+    examCatalog.clear();
+    uiMgr.discardPreparedQuestion();   // Every way out of an exam and every mode switch ends here
+    
+    // Drops the resident questions (not while the worker is opening the window)
+    if (netJob == 0 && examWindow.isOpen()) {
+        examWindow.close();
+        StringArena::printHeap("Exam freed");
+    }
 }
 
 unsigned long ExamEngine::getRemainingSeconds() {
     if (state != EXAM_RUNNING) return 0;
     unsigned long elapsed = (millis() - startTime - totalPausedTime) / 1000;
-    unsigned long totalSeconds = currentExam.durationMinutes * 60;
+    unsigned long totalSeconds = examWindow.info().durationMinutes * 60;
     return (elapsed < totalSeconds) ? (totalSeconds - elapsed) : 0;
 }
 
 void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENetworkManager& network, int& systemState) {
     switch (state) {
         case EXAM_INIT:
-            uiMgr.showLoading("Fetching Exams...");
-            display.showStatus("Fetching Exams...");
+            if (!examCatalog.isStarted()) {
+                uiMgr.showLoading("Fetching Exams...");
+                display.showStatus("Fetching Exams...");
+                
+                // Already synced this session - the store is current, skip the network
+                examCatalog.start(network, CONTENT_EXAM, !contentSync.isSynced());
+            }
             
-            availableExams = network.fetchExamList();
+            // Keep rendering until the first page (or the flash copy) is in
+            examCatalog.update(network);
+            if (!examCatalog.isReady()) break;
             
-            if (availableExams.empty()) {
+            if (examCatalog.size() == 0) {
                 state = EXAM_NO_EXAMS;
                 needsFullRedraw = true;
             } else {
@@ -77,35 +95,40 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
             
             if (input.isBtnBPressed()) {
                 reset();
-                systemState = 0;
+                systemState = STATE_MENU;
                 delay(200);
             }
             break;
 
         case EXAM_SELECT:
             {
+                // Later pages land while the list is open
+                if (examCatalog.update(network)) needsFullRedraw = true;
+                
                 // Navigation with potentiometer
-                int newIndex = input.getScrollIndex(availableExams.size());
+                int rowCount = examCatalog.displayCount();
+                int newIndex = input.getScrollIndex(rowCount);
                 
                 // Redraw if selection changed or first draw
                 if (newIndex != lastSelectedExamIndex || needsFullRedraw) {
                     selectedExamIndex = newIndex;
                     
                     // Build exam names array for UI
-                    const char* examNames[availableExams.size()];
-                    for (size_t i = 0; i < availableExams.size(); i++) {
-                        examNames[i] = availableExams[i].title.c_str();
+                    const char* examNames[rowCount];
+                    for (int i = 0; i < rowCount; i++) {
+                        examNames[i] = examCatalog.titleAt(i);
                     }
                     
-                    uiMgr.showExamList(examNames, availableExams.size(), selectedExamIndex);
+                    uiMgr.showExamList(examNames, rowCount, selectedExamIndex);
                     display.showStatus("Select Exam");
                     
                     lastSelectedExamIndex = selectedExamIndex;
                     needsFullRedraw = false;
                 }
+                examCatalog.prefetch(network, selectedExamIndex);
                 
-                // Button A: Confirm selection
-                if (input.isBtnAPressed()) {
+                // Button A: Confirm selection (not on a row still loading)
+                if (input.isBtnAPressed() && examCatalog.isLoaded(selectedExamIndex)) {
                     state = EXAM_NAME;
                     studentName = "";
                     lastInputText = "";
@@ -116,7 +139,7 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
                 // Button B: Go back to menu
                 if (input.isBtnBPressed()) {
                     reset();
-                    systemState = 0;
+                    systemState = STATE_MENU;
                     delay(200);
                 }
             }
@@ -207,18 +230,30 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
 
         case EXAM_DOWNLOAD:
             {
-                Serial.println("[EXAM] Starting download...");
-                uiMgr.showLoading("Downloading Exam...");
-                uiMgr.update();  // Force LVGL refresh
-                display.showStatus("Downloading...");
-                
-                Serial.printf("[EXAM] Fetching exam ID: %s\n", availableExams[selectedExamIndex].id.c_str());
-                String json = network.fetchExamJson(availableExams[selectedExamIndex].id);
-                
-                Serial.printf("[EXAM] Received %d bytes\n", json.length());
+                if (netJob == 0) {
+                    Serial.println("[EXAM] Starting download...");
+                    uiMgr.showLoading("Downloading Exam...");
+                    uiMgr.update();  // Force LVGL refresh
+                    display.showStatus("Downloading...");
+                    
+                    Serial.printf("[EXAM] Fetching exam ID: %s\n", examCatalog.item(selectedExamIndex).id.c_str());
+                    // Conditional fetch spools a changed exam to flash on the worker;
+                    // offline or synced, the cached pack is used as is
+                    String examId = examCatalog.item(selectedExamIndex).id;
+                    bool useNetwork = !contentSync.isSynced();
+                    examLoaded = false;
+                    examWindow.close();
+                    StringArena::printHeap("Before exam load");
+                    netJob = network.submitJob([this, &network, examId, useNetwork]() {
+                        if (useNetwork) network.syncExam(examId);
+                        examLoaded = examWindow.open(examId);
+                    });
+                }
+                if (!network.isJobDone(netJob)) return;
+                netJob = 0;
                 
-                if (json.length() == 0) {
-                    Serial.println("[EXAM] Download failed - empty response");
+                if (!examLoaded) {
+                    Serial.println("[EXAM] Download failed");
                     uiMgr.showError("Download Failed!");
                     uiMgr.update();
                     delay(2000);
@@ -228,48 +263,11 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
                     return;
                 }
                 
-                // Parse JSON
-                DynamicJsonDocument doc(16384);
-                DeserializationError error = deserializeJson(doc, json);
-                
-                if (error) {
-                    Serial.print("[EXAM] JSON Error: ");
-                    Serial.println(error.c_str());
-                    uiMgr.showError("Parse Error!");
-                    uiMgr.update();
-                    delay(2000);
-                    state = EXAM_SELECT;
-                    lastSelectedExamIndex = -1;
-                    needsFullRedraw = true;
-                    return;
-                }
-                
-                currentExam.id = doc["id"].as<String>();
-                currentExam.title = doc["title"].as<String>();
-                currentExam.durationMinutes = doc["duration_minutes"] | 30;  // Default 30 min if missing
-                currentExam.showResultsImmediate = doc["show_results_immediate"] | true;
-                
-                Serial.printf("[EXAM] Parsed: %s, Duration: %d min\n", 
-                    currentExam.title.c_str(), currentExam.durationMinutes);
-                
-                currentExam.questions.clear();
-                JsonArray qArr = doc["questions"];
-                for (JsonObject qObj : qArr) {
-                    Question q;
-                    q.id = qObj["id"];
-                    q.text = qObj["text"].as<String>();
-                    q.correctOption = qObj["correct_option"];
-                    q.options.clear();
-                    JsonArray optArr = qObj["options"];
-                    for (JsonVariant opt : optArr) {
-                        q.options.push_back(opt.as<String>());
-                    }
-                    currentExam.questions.push_back(q);
-                }
-                
-                Serial.printf("[EXAM] Loaded %d questions\n", currentExam.questions.size());
+                Serial.printf("[EXAM] Opened: %s, Duration: %d min\n", 
+                    examWindow.info().title.c_str(), examWindow.info().durationMinutes);
+                StringArena::printHeap("After exam load");
                 
-                if (currentExam.questions.size() == 0) {
+                if (examWindow.size() == 0) {
                     Serial.println("[EXAM] No questions in exam!");
                     uiMgr.showError("No Questions!");
                     uiMgr.update();
@@ -283,7 +281,7 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
                 // Init Answers
                 studentAnswers.clear();
                 answersConfirmed.clear();
-                for (size_t i = 0; i < currentExam.questions.size(); i++) {
+                for (int i = 0; i < examWindow.size(); i++) {
                     studentAnswers.push_back(-1);
                     answersConfirmed.push_back(0);  // Use 0/1 instead of false/true for uint8_t
                 }
@@ -296,19 +294,16 @@ void ExamEngine::handleSetup(DisplayManager& display, InputManager& input, SENet
                 lastQuestionIndex = -1;
                 pendingAnswer = -1;
                 needsFullRedraw = true;
-                systemState = 7; // STATE_SCANATRON_RUN (MENU=0, SETTINGS=1, ADMIN_URL=2, DEV_MODE=3, API_URL_EDIT=4, HW_TEST=5, SCANATRON_SETUP=6, SCANATRON_RUN=7)
+                systemState = STATE_SCANATRON_RUN;
                 
                 // Force immediate draw of first question
                 Serial.println("[EXAM] Drawing first question...");
-                Question& q = currentExam.questions[0];
-                const char* options[4];
-                for (size_t i = 0; i < q.options.size() && i < 4; i++) {
-                    options[i] = q.options[i].c_str();
-                }
-                uiMgr.showQuestion(1, currentExam.questions.size(), q.text.c_str(), options, q.options.size(), -1, -1);
+                const Question& q = examWindow.at(0);
+                uiMgr.discardPreparedQuestion();
+                uiMgr.showQuestion(1, examWindow.size(), q.text, q.options, q.optionCount, -1, -1);
                 uiMgr.update();
-                display.showExamTimer(currentExam.durationMinutes * 60, 1, currentExam.questions.size());
-                Serial.println("[EXAM] First question displayed!");
+                display.showExamTimer(examWindow.info().durationMinutes * 60, 1, examWindow.size());
+                Serial.printf("[EXAM] First question displayed (%u B resident)\n", examWindow.residentBytes());
             }
             break;
             
@@ -343,7 +338,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         
         // Timer Check
         unsigned long elapsed = (millis() - startTime - totalPausedTime) / 1000;
-        unsigned long totalSeconds = currentExam.durationMinutes * 60;
+        unsigned long totalSeconds = examWindow.info().durationMinutes * 60;
         unsigned long remaining = (elapsed < totalSeconds) ? (totalSeconds - elapsed) : 0;
         unsigned long currentTimerSeconds = remaining;
         
@@ -378,7 +373,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         // Update OLED timer (only once per second to reduce I2C traffic)
         static unsigned long lastOledUpdate = 0;
         if (millis() - lastOledUpdate >= 1000) {
-            display.showExamTimer(remaining, currentQuestionIndex + 1, currentExam.questions.size());
+            display.showExamTimer(remaining, currentQuestionIndex + 1, examWindow.size());
             lastOledUpdate = millis();
         }
         
@@ -435,7 +430,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                 Serial.printf("[EXAM] Nav: prev question -> %d\n", currentQuestionIndex + 1);
             }
         } else if (kbChar == ']' || kbChar == 'n' || kbChar == 'N' || kbChar == 183) {  // Right arrow
-            if (currentQuestionIndex < (int)currentExam.questions.size() - 1) {
+            if (currentQuestionIndex < examWindow.size() - 1) {
                 currentQuestionIndex++;
                 navChanged = true;
                 Serial.printf("[EXAM] Nav: next question -> %d\n", currentQuestionIndex + 1);
@@ -447,6 +442,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         }
         
         if (navChanged) {
+            uiMgr.markInput();
             if (answersConfirmed[currentQuestionIndex]) {
                 pendingAnswer = studentAnswers[currentQuestionIndex];
             } else {
@@ -496,22 +492,16 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         bool answerChanged = (pendingAnswer != lastPendingAnswer);
         
         if (needsFullRedraw || questionChanged || answerChanged) {
-            Question& q = currentExam.questions[currentQuestionIndex];
-            
-            // Build options array
-            const char* options[4];
-            for (size_t i = 0; i < q.options.size() && i < 4; i++) {
-                options[i] = q.options[i].c_str();
-            }
+            const Question& q = examWindow.at(currentQuestionIndex);
             
             int confirmedAnswer = answersConfirmed[currentQuestionIndex] ? studentAnswers[currentQuestionIndex] : -1;
             
             uiMgr.showQuestion(
                 currentQuestionIndex + 1,
-                currentExam.questions.size(),
-                q.text.c_str(),
-                options,
-                q.options.size(),
+                examWindow.size(),
+                q.text,
+                q.options,
+                q.optionCount,
                 pendingAnswer,
                 confirmedAnswer
             );
@@ -521,6 +511,16 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
             lastTimerSeconds = currentTimerSeconds;
             lastDrawTime = millis();
             needsFullRedraw = false;
+        } else if (!examWindow.prefetch(currentQuestionIndex)) {
+            // Idle pass with the window full - build the next question's screen
+            // so stepping to it is a swap
+            int next = currentQuestionIndex + 1;
+            if (next < examWindow.size()) {
+                const Question& nq = examWindow.at(next);
+                int confirmedNext = answersConfirmed[next] ? studentAnswers[next] : -1;
+                uiMgr.prepareQuestion(next + 1, examWindow.size(), nq.text, nq.options, nq.optionCount,
+                                      studentAnswers[next], confirmedNext);
+            }
         }
         
     } else if (state == EXAM_PAUSED) {
@@ -623,7 +623,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                 } else if (pauseMenuIndex == 1) {
                     // Exit exam
                     reset();
-                    systemState = 0;
+                    systemState = STATE_MENU;
                     return;
                 }
             }
@@ -698,7 +698,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         
         if (needsFullRedraw || overviewSelectedIndex != lastOverviewIndex) {
             // Calculate scroll offset
-            int maxVisible = 5;  // Match UI rows
+            int maxVisible = UI_OVERVIEW_ROWS;
             if (overviewSelectedIndex < overviewScrollOffset) {
                 overviewScrollOffset = overviewSelectedIndex;
             } else if (overviewSelectedIndex >= overviewScrollOffset + maxVisible) {
@@ -706,7 +706,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
             }
             
             uiMgr.showOverview(
-                currentExam.questions.size(),
+                examWindow.size(),
                 studentAnswers.data(),
                 answersConfirmed.data(),
                 overviewSelectedIndex,
@@ -714,6 +714,9 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
             );
             lastOverviewIndex = overviewSelectedIndex;
             needsFullRedraw = false;
+        } else {
+            // Have the highlighted question (and its neighbours) ready to jump to
+            examWindow.prefetch(overviewSelectedIndex);
         }
         
         // Navigation with potentiometer - add hysteresis to prevent jitter
@@ -723,7 +726,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         // Only update if pot changed significantly
         if (lastPotValue < 0 || abs(pot - lastPotValue) > 100) {
             lastPotValue = pot;
-            int newIndex = input.getScrollIndex(currentExam.questions.size());
+            int newIndex = input.getScrollIndex(examWindow.size());
             
             if (newIndex != overviewSelectedIndex) {
                 overviewSelectedIndex = newIndex;
@@ -739,59 +742,76 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                 needsFullRedraw = true;
             }
         } else if (c == ']' || c == 'n' || c == 'N') {
-            if (overviewSelectedIndex < (int)currentExam.questions.size() - 1) {
+            if (overviewSelectedIndex < examWindow.size() - 1) {
                 overviewSelectedIndex++;
                 needsFullRedraw = true;
             }
         }
         
     } else if (state == EXAM_SUBMITTING) {
+        // Direct upload fallback in flight - wait for it with the UI live
+        if (netJob != 0) {
+            if (!network.isJobDone(netJob)) return;
+            netJob = 0;
+            if (!uploadOk) {
+                Serial.println("[EXAM] Upload failed and result could not be queued!");
+            }
+            state = examWindow.info().showResultsImmediate ? EXAM_SHOW_RESULT : EXAM_DONE;
+            needsFullRedraw = true;
+            return;
+        }
+        
+        uiMgr.discardPreparedQuestion();
         uiMgr.showLoading("Submitting Exam...");
         display.showStatus("Submitting...");
         
         // Calculate Score
         int score = 0;
-        for (size_t i = 0; i < currentExam.questions.size(); i++) {
-            if (studentAnswers[i] == currentExam.questions[i].correctOption) score++;
+        for (int i = 0; i < examWindow.size(); i++) {
+            if (studentAnswers[i] == examWindow.correctOption(i)) score++;
         }
         
-        // Create JSON
-        DynamicJsonDocument doc(4096);
-        doc["exam_id"] = currentExam.id;
+        // Create JSON, sized for this exam: one slot per answer, the copied
+        // strings, and room for the submission id the queue adds
+        size_t capacity = JSON_OBJECT_SIZE(7) + JSON_ARRAY_SIZE(examWindow.size()) +
+                          examWindow.info().id.length() + studentName.length() + studentId.length() + 64;
+        DynamicJsonDocument doc(capacity);
+        doc["exam_id"] = examWindow.info().id;
         doc["student_name"] = studentName;
         doc["student_id"] = studentId;
         doc["score"] = score;
-        doc["total_questions"] = currentExam.questions.size();
+        doc["total_questions"] = examWindow.size();
         JsonArray ansArr = doc.createNestedArray("answers");
         for (int a : studentAnswers) ansArr.add(a);
-        
-        String payload;
-        serializeJson(doc, payload);
-        
-        bool success = network.uploadResult(payload);
-        
-        if (!success) {
-            Serial.println("[EXAM] Upload failed, but continuing...");
+        if (doc.overflowed()) {
+            Serial.printf("[EXAM] Result document overflowed (%u B)\n", capacity);
         }
         
-        if (currentExam.showResultsImmediate) {
-            state = EXAM_SHOW_RESULT;
-            needsFullRedraw = true;
-        } else {
-            state = EXAM_DONE;
+        // Persist first - the queue uploads in the background and survives
+        // a flaky AP or a reboot. Only if flash fails, try the network directly.
+        if (resultQueue.enqueue(doc)) {
+            resultQueue.flushSoon();
+            state = examWindow.info().showResultsImmediate ? EXAM_SHOW_RESULT : EXAM_DONE;
             needsFullRedraw = true;
+            return;
         }
         
+        String payload;
+        serializeJson(doc, payload);
+        
+        uploadOk = false;
+        netJob = network.submitJob([this, &network, payload]() { uploadOk = network.uploadResult(payload); });
+        
     } else if (state == EXAM_SHOW_RESULT) {
         if (needsFullRedraw) {
             ledOff();  // Ensure LED is off
             int score = 0;
-            for (size_t i = 0; i < currentExam.questions.size(); i++) {
-                if (studentAnswers[i] == currentExam.questions[i].correctOption) score++;
+            for (int i = 0; i < examWindow.size(); i++) {
+                if (studentAnswers[i] == examWindow.correctOption(i)) score++;
             }
-            float pct = (float)score / currentExam.questions.size() * 100.0f;
+            float pct = (float)score / examWindow.size() * 100.0f;
             
-            uiMgr.showResult(score, currentExam.questions.size(), pct);
+            uiMgr.showResult(score, examWindow.size(), pct);
             display.showStatus("Results");
             
             // Feedback based on score
@@ -814,7 +834,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         
         if (input.isBtnAPressed() || input.isBtnBPressed()) {
             reset();
-            systemState = 0;
+            systemState = STATE_MENU;
             delay(200);
         }
         
@@ -830,7 +850,7 @@ void ExamEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
         
         if (input.isBtnAPressed() || input.isBtnBPressed()) {
             reset();
-            systemState = 0;
+            systemState = STATE_MENU;
             delay(200);
         }
     }
@@ -5,24 +5,11 @@
 #include "DisplayManager.h"
 #include "InputManager.h"
 #include "NetworkManager.h"
+#include "CatalogPager.h"
+#include "ExamWindow.h"
 #include "UIManager.h"
 #include <vector>
 
-struct Question {
-    int id;
-    String text;
-    std::vector<String> options;
-    int correctOption;
-};
-
-struct ExamData {
-    String id;
-    String title;
-    int durationMinutes;
-    bool showResultsImmediate;
-    std::vector<Question> questions;
-};
-
 enum ExamState {
     EXAM_INIT,
     EXAM_NO_EXAMS,    // No exams found - waiting for B to go back
@@ -41,7 +28,7 @@ enum ExamState {
 class ExamEngine {
 private:
     ExamState state = EXAM_INIT;
-    std::vector<ExamMetadata> availableExams;
+    CatalogPager examCatalog;
     int selectedExamIndex = 0;
     int lastSelectedExamIndex = -1;
     
@@ -49,7 +36,12 @@ private:
     String studentId = "";
     String lastInputText = "";
     
-    ExamData currentExam;
+    ExamWindow examWindow;   // Questions around the current one; the rest stay on flash
+    
+    // In-flight network worker job (0 = none) and its outcome
+    NetJobId netJob = 0;
+    volatile bool examLoaded = false;
+    volatile bool uploadOk = false;
     std::vector<int> studentAnswers;
     std::vector<uint8_t> answersConfirmed;  // Use uint8_t instead of bool (vector<bool> has no data())
     int currentQuestionIndex = 0;
@@ -89,7 +81,7 @@ public:
     // Get remaining time for OLED display
     unsigned long getRemainingSeconds();
     int getCurrentQuestion() { return currentQuestionIndex + 1; }
-    int getTotalQuestions() { return currentExam.questions.size(); }
+    int getTotalQuestions() { return examWindow.size(); }
     bool isRunning() { return state == EXAM_RUNNING; }
 };
 
@@ -0,0 +1,85 @@
+/**
+ * Exam Window Implementation
+ */
+
+#include "ExamWindow.h"
+#include "ContentStore.h"
+
+bool ExamWindow::open(const String& examId) {
+    close();
+    unsigned long t0 = millis();
+    if (!contentStore.openExam(examId, pack) || !pack.loadExamInfo(exam)) {
+        close();
+        return false;
+    }
+
+    // Scoring needs every answer, so the key is read up front from the
+    // fixed-size records - no question text is touched
+    answerKey.reserve(pack.count());
+    for (uint32_t i = 0; i < pack.count(); i++) {
+        PackQuestionRecord rec;
+        if (!pack.readQuestion(i, rec)) {
+            close();
+            return false;
+        }
+        answerKey.push_back(rec.correctOption);
+    }
+
+    Serial.printf("[EXAM] Window on %s: %d questions%s, key read in %lu ms\n", examId.c_str(), size(),
+                  pack.isMapped() ? " (mapped)" : "", millis() - t0);
+    return true;
+}
+
+void ExamWindow::close() {
+    for (Slot& s : slots) {
+        s.index = -1;
+        s.question = Question();
+        s.text.reset();
+    }
+    answerKey.clear();
+    answerKey.shrink_to_fit();
+    exam = ExamData();
+    pack.close();
+}
+
+int8_t ExamWindow::correctOption(int index) const {
+    return (index >= 0 && index < size()) ? answerKey[index] : -1;
+}
+
+ExamWindow::Slot& ExamWindow::load(int index) {
+    Slot& s = slots[index % EXAM_WINDOW_SLOTS];
+    if (s.index == index) return s;
+
+    s.text.reset();
+    s.question = Question();
+    if (!pack.loadQuestion(index, s.question, s.text)) {
+        Serial.printf("[EXAM] Question %d unreadable\n", index + 1);
+    }
+    s.index = index;
+    return s;
+}
+
+const Question& ExamWindow::at(int index) {
+    static const Question none;
+    if (index < 0 || index >= size()) return none;
+    return load(index).question;
+}
+
+bool ExamWindow::prefetch(int index) {
+    // Nearest first, next before previous - the usual direction of travel
+    for (int d = 0; d <= EXAM_WINDOW_RADIUS; d++) {
+        int around[2] = {index + d, index - d};
+        for (int i : around) {
+            if (i < 0 || i >= size() || slots[i % EXAM_WINDOW_SLOTS].index == i) continue;
+            load(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t ExamWindow::residentBytes() const {
+    size_t bytes = 0;
+    for (const Slot& s : slots) bytes += s.text.used();
+    return bytes;
+}
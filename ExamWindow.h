@@ -0,0 +1,61 @@
+/**
+ * Exam Window - Exam questions paged in from the cached pack
+ * Downloads spool every question to flash, so an exam is never whole in
+ * RAM. Only the current question and EXAM_WINDOW_RADIUS neighbours on each
+ * side are resident; the next and previous ones are read ahead one per loop
+ * pass as the student moves, so stepping through the exam never waits on
+ * flash. Exam length is bounded by flash, not heap - beyond the window the
+ * only per-question cost is one byte of answer key.
+ */
+
+#ifndef EXAM_WINDOW_H
+#define EXAM_WINDOW_H
+
+#include <Arduino.h>
+#include <vector>
+#include "NetworkManager.h"
+#include "ContentPack.h"
+
+#define EXAM_WINDOW_RADIUS    2                              // Neighbours kept each side
+#define EXAM_WINDOW_SLOTS     (2 * EXAM_WINDOW_RADIUS + 1)
+#define EXAM_SLOT_ARENA_SIZE  1024                           // One question and its options
+
+class ExamWindow {
+private:
+    // Question i always lives in slot i % EXAM_WINDOW_SLOTS, so the current
+    // question and its neighbours never evict each other
+    struct Slot {
+        int index = -1;
+        Question question;
+        StringArena text{EXAM_SLOT_ARENA_SIZE};   // Unused when the pack is mapped
+    };
+
+    PackReader pack;
+    ExamData exam;
+    std::vector<int8_t> answerKey;   // Correct option per question, for scoring
+    Slot slots[EXAM_WINDOW_SLOTS];
+
+    Slot& load(int index);
+
+public:
+    // Reads the header and answer key from the cached pack
+    bool open(const String& examId);
+    void close();
+    bool isOpen() { return pack.isOpen(); }
+
+    const ExamData& info() const { return exam; }
+    int size() const { return answerKey.size(); }
+    int8_t correctOption(int index) const;
+
+    // Question `index`, read from flash on a miss. Its text stays valid
+    // until the window moves more than EXAM_WINDOW_RADIUS past it.
+    const Question& at(int index);
+
+    // Reads ahead the nearest question around `index` (itself included) that
+    // is not resident yet. Returns true if it read one; call once per loop pass.
+    bool prefetch(int index);
+
+    size_t residentBytes() const;
+};
+
+#endif
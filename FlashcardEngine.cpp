@@ -1,4 +1,6 @@
 #include "FlashcardEngine.h"
+#include "ContentStore.h"
+#include "ContentSync.h"
 
 // External feedback functions from main sketch
 extern void beepClick();
@@ -16,24 +18,69 @@ void FlashcardEngine::reset() {
     lastSelectedDeckIndex = -1;
     currentCardIndex = 0;
     needsFullRedraw = true;
-    availableDecks.clear();
-    currentDeck.cards.clear();
+    deckCatalog.clear();
+    deckPack.close();
+    downloadedDeck.clear();
+    cardRatings.clear();
+    cardCount = 0;
+    loadedCardIndex = -1;
+}
+
+// Seeks to one card in the pack. A mapped pack hands out its text in place;
+// otherwise both faces are read into the text buffers.
+bool FlashcardEngine::loadCard(int index) {
+    if (index == loadedCardIndex) return true;
+
+    // No pack - the deck is the in-RAM copy from the download
+    if (!deckPack.isOpen()) {
+        if (index < 0 || index >= (int)downloadedDeck.cards.size()) return false;
+        cardFront = downloadedDeck.cards[index].front;
+        cardBack = downloadedDeck.cards[index].back;
+        loadedCardIndex = index;
+        return true;
+    }
+
+    PackCardRecord rec;
+    if (!deckPack.readCard(index, rec)) {
+        frontText[0] = backText[0] = '\0';
+        cardFront = frontText;
+        cardBack = backText;
+        return false;
+    }
+    if (deckPack.isMapped()) {
+        cardFront = deckPack.stringView(rec.frontRef);
+        cardBack = deckPack.stringView(rec.backRef);
+        if (!cardFront) cardFront = "";
+        if (!cardBack) cardBack = "";
+    } else {
+        deckPack.readString(rec.frontRef, frontText, sizeof(frontText));
+        deckPack.readString(rec.backRef, backText, sizeof(backText));
+        cardFront = frontText;
+        cardBack = backText;
+    }
+    loadedCardIndex = index;
+    return true;
 }
 
 void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SENetworkManager& network, int& systemState) {
     switch (state) {
         case FC_INIT:
-            uiMgr.showLoading("Fetching Decks...");
-            display.showStatus("Fetching Decks...");
+            if (!deckCatalog.isStarted()) {
+                uiMgr.showLoading("Fetching Decks...");
+                display.showStatus("Fetching Decks...");
+                
+                // Already synced this session - the store is current, skip the network
+                deckCatalog.start(network, CONTENT_DECK, !contentSync.isSynced());
+            }
             
-            // We need to implement fetchDeckList in NetworkManager
-            // For now, we'll assume it returns a vector of Decks with just ID and Title
-            availableDecks = network.fetchDeckList();
+            // Keep rendering until the first page (or the flash copy) is in
+            deckCatalog.update(network);
+            if (!deckCatalog.isReady()) break;
             
-            if (availableDecks.empty()) {
+            if (deckCatalog.size() == 0) {
                 uiMgr.showError("No Decks Found!");
                 delay(2000);
-                systemState = 0; // Back to menu
+                systemState = STATE_MENU;
             } else {
                 state = FC_SELECT_DECK;
                 lastSelectedDeckIndex = -1;
@@ -43,33 +90,38 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
 
         case FC_SELECT_DECK:
             {
+                // Later pages land while the list is open
+                if (deckCatalog.update(network)) needsFullRedraw = true;
+                
                 // Navigation
-                int newIndex = input.getScrollIndex(availableDecks.size());
+                int rowCount = deckCatalog.displayCount();
+                int newIndex = input.getScrollIndex(rowCount);
                 
                 if (newIndex != selectedDeckIndex || needsFullRedraw) {
                     selectedDeckIndex = newIndex;
                     
-                    const char* deckNames[availableDecks.size()];
-                    for (size_t i = 0; i < availableDecks.size(); i++) {
-                        deckNames[i] = availableDecks[i].title.c_str();
+                    const char* deckNames[rowCount];
+                    for (int i = 0; i < rowCount; i++) {
+                        deckNames[i] = deckCatalog.titleAt(i);
                     }
                     
                     // Reuse exam list UI for now, or create specific one
-                    uiMgr.showExamList(deckNames, availableDecks.size(), selectedDeckIndex, "Select Deck");
+                    uiMgr.showExamList(deckNames, rowCount, selectedDeckIndex, "Select Deck");
                     display.showStatus("Select Deck");
                     
                     lastSelectedDeckIndex = selectedDeckIndex;
                     needsFullRedraw = false;
                 }
+                deckCatalog.prefetch(network, selectedDeckIndex);
                 
-                if (input.isBtnAPressed()) {
+                if (input.isBtnAPressed() && deckCatalog.isLoaded(selectedDeckIndex)) {
                     state = FC_DOWNLOAD;
                     needsFullRedraw = true;
                     delay(200);
                 }
                 
                 if (input.isBtnBPressed()) {
-                    systemState = 0; // Back to menu
+                    systemState = STATE_MENU;
                     delay(200);
                 }
             }
@@ -77,19 +129,46 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
 
         case FC_DOWNLOAD:
             {
-                uiMgr.showLoading("Downloading Deck...");
-                display.showStatus("Downloading...");
+                const String& deckId = deckCatalog.item(selectedDeckIndex).id;
+                if (netJob == 0) {
+                    uiMgr.showLoading("Downloading Deck...");
+                    display.showStatus("Downloading...");
+                    
+                    // Revalidate the cached pack (a single 304 when unchanged) on the
+                    // worker. Offline or synced, the cached pack is used as-is.
+                    // A completely parsed deck is kept in case the pack cannot be saved.
+                    if (!contentSync.isSynced()) {
+                        String id = deckId;
+                        downloadedDeck.clear();
+                        netJob = network.submitJob([this, id, &network]() { network.syncDeck(id, &downloadedDeck); });
+                    }
+                }
+                if (netJob && !network.isJobDone(netJob)) break;
+                netJob = 0;
                 
-                // Fetch full deck
-                Deck fullDeck = network.fetchDeck(availableDecks[selectedDeckIndex].id);
+                contentStore.openDeck(deckId, deckPack);
+                if (!deckPack.isOpen() || deckPack.count() == 0) {
+                    deckPack.close();
+                    if (!downloadedDeck.cards.empty()) {
+                        // Store full or unmounted - show the deck that did download
+                        // (syncDeck only leaves it filled when the body was complete)
+                        Serial.printf("[FC] Pack unavailable, using downloaded deck (%d cards)\n",
+                                      downloadedDeck.cards.size());
+                    }
+                } else {
+                    downloadedDeck.clear();
+                }
                 
-                if (fullDeck.cards.empty()) {
+                int available = deckPack.isOpen() ? deckPack.count() : downloadedDeck.cards.size();
+                if (available == 0) {
                     uiMgr.showError("Empty Deck!");
                     delay(2000);
                     state = FC_SELECT_DECK;
                     needsFullRedraw = true;
                 } else {
-                    currentDeck = fullDeck;
+                    cardCount = available;
+                    cardRatings.assign(cardCount, 0);
+                    loadedCardIndex = -1;
                     state = FC_SHOW_FRONT;
                     currentCardIndex = 0;
                     sessionStartTime = millis();
@@ -101,15 +180,12 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
         case FC_SHOW_FRONT:
             {
                 if (needsFullRedraw) {
-                    uiMgr.showFlashcardFront(
-                        currentDeck.cards[currentCardIndex].front.c_str(),
-                        currentCardIndex + 1,
-                        currentDeck.cards.size()
-                    );
+                    loadCard(currentCardIndex);
+                    uiMgr.showFlashcardFront(cardFront, currentCardIndex + 1, cardCount);
                     
                     // Update OLED
                     char status[20];
-                    sprintf(status, "Card %d/%d", currentCardIndex + 1, currentDeck.cards.size());
+                    sprintf(status, "Card %d/%d", currentCardIndex + 1, cardCount);
                     display.showStatus(status);
                     
                     needsFullRedraw = false;
@@ -138,10 +214,8 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
         case FC_SHOW_BACK:
             {
                 if (needsFullRedraw) {
-                    uiMgr.showFlashcardBack(
-                        currentDeck.cards[currentCardIndex].front.c_str(),
-                        currentDeck.cards[currentCardIndex].back.c_str()
-                    );
+                    loadCard(currentCardIndex);
+                    uiMgr.showFlashcardBack(cardFront, cardBack);
                     display.showStatus("Rate Difficulty");
                     needsFullRedraw = false;
                 }
@@ -164,7 +238,7 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
                 else if (input.isBtnDPressed()) rating = 4;
                 
                 if (rating > 0) {
-                    currentDeck.cards[currentCardIndex].rating = rating;
+                    cardRatings[currentCardIndex] = rating;
                     
                     // Feedback based on rating
                     if (rating >= 3) {
@@ -181,7 +255,7 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
                     }
                     
                     currentCardIndex++;
-                    if (currentCardIndex >= (int)currentDeck.cards.size()) {
+                    if (currentCardIndex >= cardCount) {
                         state = FC_FINISHED;
                     } else {
                         state = FC_SHOW_FRONT;
@@ -238,10 +312,10 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
                 if (needsFullRedraw) {
                     // Calculate stats
                     int easy = 0, hard = 0, again = 0, good = 0;
-                    for (const auto& card : currentDeck.cards) {
-                        if (card.rating == 4) easy++;
-                        else if (card.rating == 3) good++;
-                        else if (card.rating == 2) hard++;
+                    for (uint8_t rating : cardRatings) {
+                        if (rating == 4) easy++;
+                        else if (rating == 3) good++;
+                        else if (rating == 2) hard++;
                         else again++;
                     }
                     
@@ -252,7 +326,7 @@ void FlashcardEngine::handleRun(DisplayManager& display, InputManager& input, SE
                         finishedFeedbackDone = true;
                     }
                     
-                    uiMgr.showFlashcardFinished(currentDeck.cards.size(), easy, hard, again);
+                    uiMgr.showFlashcardFinished(cardCount, easy, hard, again);
                     display.showStatus("Deck Complete!");
                     needsFullRedraw = false;
                 }
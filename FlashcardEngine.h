@@ -5,7 +5,9 @@
 #include "DisplayManager.h"
 #include "InputManager.h"
 #include "NetworkManager.h"
+#include "CatalogPager.h"
 #include "UIManager.h"
+#include "ContentPack.h"
 #include <vector>
 #include <ArduinoJson.h>
 
@@ -22,8 +24,18 @@ enum FlashcardState {
 class FlashcardEngine {
 private:
     FlashcardState state = FC_INIT;
-    std::vector<Deck> availableDecks;
-    Deck currentDeck;
+    CatalogPager deckCatalog;
+    
+    // Current deck is read card-by-card from its cached pack
+    PackReader deckPack;
+    Deck downloadedDeck;   // Parsed copy from the last download - used only if the pack cannot be written or opened
+    std::vector<uint8_t> cardRatings;  // 0=None, 1=Again, 2=Hard, 3=Good, 4=Easy
+    int cardCount = 0;
+    char frontText[PACK_TEXT_MAX];
+    char backText[PACK_TEXT_MAX];
+    const char* cardFront = frontText;   // Mapped flash, or the buffers above
+    const char* cardBack = backText;
+    int loadedCardIndex = -1;
     
     int selectedDeckIndex = 0;
     int lastSelectedDeckIndex = -1;
@@ -31,6 +43,9 @@ private:
     int currentCardIndex = 0;
     bool needsFullRedraw = true;
     
+    // In-flight network worker job (0 = none)
+    NetJobId netJob = 0;
+    
     unsigned long sessionStartTime = 0;
     
     // Pause Menu
@@ -44,6 +59,8 @@ private:
     // For OLED stats
     unsigned long lastOledUpdate = 0;
 
+    bool loadCard(int index);
+
 public:
     void reset();
     void handleRun(DisplayManager& display, InputManager& input, SENetworkManager& network, int& systemState);
@@ -0,0 +1,97 @@
+/**
+ * Frame Stats Implementation
+ */
+
+#include "FrameStats.h"
+#include <algorithm>
+
+// ===================================================================================
+// ROLLING STAT
+// ===================================================================================
+
+void RollingStat::add(uint32_t us) {
+    samples[head] = us;
+    head = (head + 1) % FRAME_STATS_WINDOW;
+    if (count < FRAME_STATS_WINDOW) count++;
+    last = us;
+}
+
+void RollingStat::reset() {
+    head = 0;
+    count = 0;
+    last = 0;
+}
+
+FrameStatSummary RollingStat::summarize() const {
+    FrameStatSummary s = {};
+    s.count = count;
+    if (count == 0) return s;
+
+    uint32_t sorted[FRAME_STATS_WINDOW];
+    memcpy(sorted, samples, count * sizeof(uint32_t));
+    std::sort(sorted, sorted + count);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; i++) total += sorted[i];
+
+    s.minUs = sorted[0];
+    s.maxUs = sorted[count - 1];
+    s.avgUs = total / count;
+    s.p99Us = sorted[(count * 99) / 100];
+    return s;
+}
+
+// ===================================================================================
+// FRAME STATS
+// ===================================================================================
+
+void FrameStats::beginFrame() {
+    frameStartUs = micros();
+    frameFlushUs = 0;
+}
+
+void FrameStats::endFrame() {
+    uint32_t total = micros() - frameStartUs;
+    flush.add(frameFlushUs);
+    draw.add(total > frameFlushUs ? total - frameFlushUs : 0);
+    framesInSecond++;
+}
+
+uint32_t FrameStats::loopTick() {
+    uint32_t now = micros();
+    uint32_t us = lastLoopUs ? now - lastLoopUs : 0;
+    lastLoopUs = now;
+    if (us) loop.add(us);
+    return us;
+}
+
+uint32_t FrameStats::getFps() {
+    uint32_t now = millis();
+    if (now - secondStartMs >= 1000) {
+        fps = framesInSecond * 1000 / (now - secondStartMs);
+        framesInSecond = 0;
+        secondStartMs = now;
+    }
+    return fps;
+}
+
+void FrameStats::print() {
+    static const char* names[3] = {"draw", "flush", "loop"};
+    const RollingStat* stats[3] = {&draw, &flush, &loop};
+
+    Serial.printf("[UI] %lu fps\n", getFps());
+    for (int i = 0; i < 3; i++) {
+        FrameStatSummary s = stats[i]->summarize();
+        Serial.printf("[UI]  %-5s n=%lu min %lu avg %lu p99 %lu max %lu us\n",
+                      names[i], s.count, s.minUs, s.avgUs, s.p99Us, s.maxUs);
+    }
+}
+
+void FrameStats::reset() {
+    draw.reset();
+    flush.reset();
+    loop.reset();
+    framesInSecond = 0;
+    secondStartMs = millis();
+    fps = 0;
+}
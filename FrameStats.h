@@ -0,0 +1,70 @@
+/**
+ * Frame Stats - UI frame timing
+ * Each LVGL frame is split into draw time (rendering into the stripe
+ * buffers) and flush time (pushing stripes to the panel, including waits on
+ * DMA), and the main loop period is measured alongside. Each measurement
+ * keeps a rolling window of recent samples, summarised as min/avg/p99/max,
+ * so a blocking call that stalls the UI in class shows up as a loop p99
+ * spike rather than disappearing into an average. Nothing here allocates.
+ */
+
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <Arduino.h>
+
+#define FRAME_STATS_WINDOW  128      // Samples kept per measurement
+#define FRAME_STALL_US      100000   // A loop pass longer than this is a stall
+
+// Summary of one rolling window, in microseconds
+struct FrameStatSummary {
+    uint32_t count;
+    uint32_t minUs;
+    uint32_t avgUs;
+    uint32_t p99Us;
+    uint32_t maxUs;
+};
+
+// Fixed ring of the most recent durations
+class RollingStat {
+private:
+    uint32_t samples[FRAME_STATS_WINDOW];
+    size_t head = 0;     // Next slot to write
+    size_t count = 0;
+    uint32_t last = 0;
+
+public:
+    void add(uint32_t us);
+    void reset();
+    uint32_t lastUs() const { return last; }
+    FrameStatSummary summarize() const;   // Sorts a copy - call at report rate, not per frame
+};
+
+class FrameStats {
+private:
+    uint32_t frameStartUs = 0;
+    uint32_t frameFlushUs = 0;       // Flush time accrued by the frame in progress
+    uint32_t lastLoopUs = 0;
+    uint32_t framesInSecond = 0;
+    uint32_t secondStartMs = 0;
+    uint32_t fps = 0;
+
+public:
+    RollingStat draw;
+    RollingStat flush;
+    RollingStat loop;
+
+    // Called from the display's render start/ready events and the flush path
+    void beginFrame();
+    void addFlush(uint32_t us) { frameFlushUs += us; }
+    void endFrame();
+
+    // Called at the top of loop() only; returns the pass length in microseconds
+    uint32_t loopTick();
+
+    uint32_t getFps();               // Frames rendered in the last full second
+    void print();
+    void reset();
+};
+
+#endif
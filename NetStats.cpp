@@ -0,0 +1,182 @@
+/**
+ * Net Stats Implementation
+ */
+
+#include "NetStats.h"
+
+// ===================================================================================
+// TIMED STREAM
+// ===================================================================================
+
+TimedStream::TimedStream(Stream& s) : inner(s), startUs(micros()) {
+    setTimeout(s.getTimeout());
+}
+
+void TimedStream::endStall() {
+    if (stallStart) {
+        waitUs += micros() - stallStart;
+        stallStart = 0;
+    }
+}
+
+int TimedStream::available() {
+    int n = inner.available();
+    if (n > 0) endStall();
+    else if (!stallStart) stallStart = micros();
+    return n;
+}
+
+int TimedStream::read() {
+    int c = inner.read();
+    if (c < 0) {
+        // Stream::timedRead() spins on us until data arrives - count that as waiting
+        if (!stallStart) stallStart = micros();
+        return c;
+    }
+    endStall();
+    bytes++;
+    return c;
+}
+
+int TimedStream::peek() {
+    int c = inner.peek();
+    if (c < 0) {
+        if (!stallStart) stallStart = micros();
+    } else {
+        endStall();
+    }
+    return c;
+}
+
+size_t TimedStream::readBytes(char* buffer, size_t length) {
+    // The inner client blocks here until bytes arrive or it times out
+    endStall();
+    uint32_t t0 = micros();
+    size_t n = inner.readBytes(buffer, length);
+    waitUs += micros() - t0;
+    bytes += n;
+    return n;
+}
+
+// ===================================================================================
+// NET STATS
+// ===================================================================================
+
+void NetStats::endpointName(const String& path, char* out, size_t len) {
+    // First segment names the resource; /generate and /results also keep their
+    // action segment. Anything deeper is an id.
+    String p = path;
+    int query = p.indexOf('?');
+    if (query >= 0) p = p.substring(0, query);
+
+    int second = p.indexOf('/', 1);
+    String name = second < 0 ? p : p.substring(0, second);
+    if (second >= 0) {
+        int third = p.indexOf('/', second + 1);
+        if (name == "/generate" || name == "/results") {
+            name += third < 0 ? p.substring(second) : p.substring(second, third);
+            if (third >= 0) name += "/*";
+        } else {
+            name += "/*";
+        }
+    }
+    strlcpy(out, name.c_str(), len);
+}
+
+int NetStats::bucketFor(uint32_t ms) {
+    static const uint32_t limits[NET_HIST_BUCKETS - 1] = {100, 250, 500, 1000, 2000};
+    for (int i = 0; i < NET_HIST_BUCKETS - 1; i++) {
+        if (ms < limits[i]) return i;
+    }
+    return NET_HIST_BUCKETS - 1;
+}
+
+const char* NetStats::bucketLabel(int bucket) {
+    static const char* labels[NET_HIST_BUCKETS] = {"<100", "<250", "<500", "<1s", "<2s", "2s+"};
+    return labels[bucket];
+}
+
+NetEndpointStats* NetStats::endpointFor(const char* endpoint) {
+    for (size_t i = 0; i < endpointCount; i++) {
+        if (strcmp(endpoints[i].endpoint, endpoint) == 0) return &endpoints[i];
+    }
+    // Table full - the last slot collects everything else
+    if (endpointCount == NET_STATS_MAX_ENDPOINTS) return &endpoints[NET_STATS_MAX_ENDPOINTS - 1];
+
+    NetEndpointStats* e = &endpoints[endpointCount++];
+    memset(e, 0, sizeof(*e));
+    strlcpy(e->endpoint, endpointCount == NET_STATS_MAX_ENDPOINTS ? "(other)" : endpoint, sizeof(e->endpoint));
+    return e;
+}
+
+void NetStats::record(const NetRequestSample& sample) {
+    uint32_t total = sample.totalMs();
+
+    portENTER_CRITICAL(&lock);
+    ring[ringHead] = sample;
+    ringHead = (ringHead + 1) % NET_STATS_RING_SIZE;
+    if (ringCount < NET_STATS_RING_SIZE) ringCount++;
+    totalRequests++;
+
+    NetEndpointStats* e = endpointFor(sample.endpoint);
+    e->count++;
+    if (sample.status < 200 || sample.status >= 400) e->errors++;
+    e->connectMsTotal += sample.dnsMs + sample.connectMs;
+    e->ttfbMsTotal += sample.ttfbMs;
+    e->transferMsTotal += sample.transferMs;
+    e->parseMsTotal += sample.parseMs;
+    e->bytesTotal += sample.bytes;
+    if (total > e->maxMs) e->maxMs = total;
+    e->histogram[bucketFor(total)]++;
+    portEXIT_CRITICAL(&lock);
+}
+
+void NetStats::print(const NetRequestSample& s) {
+    Serial.printf("[NET] %s %s -> %d | dns %u conn %u ttfb %u xfer %u parse %u = %lu ms | %lu B%s\n",
+                  s.method, s.endpoint, s.status, s.dnsMs, s.connectMs, s.ttfbMs,
+                  s.transferMs, s.parseMs, s.totalMs(), s.bytes, s.reused ? " (reused)" : "");
+}
+
+void NetStats::printSummary() {
+    NetEndpointStats copy[NET_STATS_MAX_ENDPOINTS];
+    size_t n = copyEndpoints(copy, NET_STATS_MAX_ENDPOINTS);
+
+    Serial.printf("[NET] %lu requests since boot\n", totalRequests);
+    for (size_t i = 0; i < n; i++) {
+        const NetEndpointStats& e = copy[i];
+        Serial.printf("[NET]  %-22s n=%lu err=%lu avg conn %lu ttfb %lu xfer %lu parse %lu max %lu ms |",
+                      e.endpoint, e.count, e.errors, e.connectMsTotal / e.count, e.ttfbMsTotal / e.count,
+                      e.transferMsTotal / e.count, e.parseMsTotal / e.count, e.maxMs);
+        for (int b = 0; b < NET_HIST_BUCKETS; b++) {
+            Serial.printf(" %s:%lu", bucketLabel(b), e.histogram[b]);
+        }
+        Serial.println();
+    }
+}
+
+void NetStats::reset() {
+    portENTER_CRITICAL(&lock);
+    ringHead = 0;
+    ringCount = 0;
+    endpointCount = 0;
+    totalRequests = 0;
+    portEXIT_CRITICAL(&lock);
+}
+
+size_t NetStats::copyRecent(NetRequestSample* out, size_t max) {
+    portENTER_CRITICAL(&lock);
+    size_t n = min(max, ringCount);
+    for (size_t i = 0; i < n; i++) {
+        out[i] = ring[(ringHead + NET_STATS_RING_SIZE - 1 - i) % NET_STATS_RING_SIZE];
+    }
+    portEXIT_CRITICAL(&lock);
+    return n;
+}
+
+size_t NetStats::copyEndpoints(NetEndpointStats* out, size_t max) {
+    portENTER_CRITICAL(&lock);
+    size_t n = min(max, endpointCount);
+    memcpy(out, endpoints, n * sizeof(NetEndpointStats));
+    portEXIT_CRITICAL(&lock);
+    return n;
+}
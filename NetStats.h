@@ -0,0 +1,108 @@
+/**
+ * Net Stats - Per-request network timing
+ * Every request through SENetworkManager is broken into DNS, connect,
+ * time-to-first-byte, body transfer and parse time. The last requests are
+ * kept in a fixed ring and totals are bucketed per endpoint, so a slow
+ * backend (high TTFB) can be told apart from a slow hotspot (high connect
+ * and transfer) on site. Nothing here allocates after boot.
+ */
+
+#ifndef NET_STATS_H
+#define NET_STATS_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+#define NET_STATS_RING_SIZE      32   // Most recent requests kept
+#define NET_STATS_MAX_ENDPOINTS  12   // Distinct endpoints tracked
+#define NET_STATS_ENDPOINT_LEN   24
+#define NET_HIST_BUCKETS         6    // <100, <250, <500, <1000, <2000, >=2000 ms
+
+// One finished request
+struct NetRequestSample {
+    char endpoint[NET_STATS_ENDPOINT_LEN];  // Path with ids collapsed ("/decks/*")
+    char method[5];
+    int16_t status;        // HTTP status, or HTTPClient error (< 0)
+    bool reused;           // Rode the open keep-alive socket
+    uint16_t dnsMs;
+    uint16_t connectMs;
+    uint16_t ttfbMs;       // Request sent -> response headers parsed
+    uint16_t transferMs;   // Time spent waiting on body bytes
+    uint16_t parseMs;      // Time spent decoding the body in between reads
+    uint32_t bytes;
+
+    uint32_t totalMs() const { return dnsMs + connectMs + ttfbMs + transferMs + parseMs; }
+};
+
+// Aggregates for one endpoint since boot
+struct NetEndpointStats {
+    char endpoint[NET_STATS_ENDPOINT_LEN];
+    uint32_t count;
+    uint32_t errors;
+    uint32_t connectMsTotal;
+    uint32_t ttfbMsTotal;
+    uint32_t transferMsTotal;
+    uint32_t parseMsTotal;
+    uint32_t maxMs;
+    uint32_t bytesTotal;
+    uint32_t histogram[NET_HIST_BUCKETS];  // Total request time
+};
+
+// Stream wrapper that counts body bytes and separates time spent blocked on
+// the socket from time the parser spends between reads
+class TimedStream : public Stream {
+private:
+    Stream& inner;
+    uint32_t bytes = 0;
+    uint32_t waitUs = 0;
+    uint32_t stallStart = 0;  // Set when a non-blocking read found no data
+    uint32_t startUs;
+
+    void endStall();
+
+public:
+    TimedStream(Stream& s);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t write(uint8_t) override { return 0; }
+
+    uint32_t bytesRead() const { return bytes; }
+    uint32_t waitMs() const { return waitUs / 1000; }
+    uint32_t elapsedMs() const { return (micros() - startUs) / 1000; }
+};
+
+class NetStats {
+private:
+    NetRequestSample ring[NET_STATS_RING_SIZE];
+    size_t ringHead = 0;      // Next slot to write
+    size_t ringCount = 0;
+    NetEndpointStats endpoints[NET_STATS_MAX_ENDPOINTS];
+    size_t endpointCount = 0;
+    uint32_t totalRequests = 0;
+
+    // Written by the network worker, read by the dev screen on the main loop
+    portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+    NetEndpointStats* endpointFor(const char* endpoint);
+
+public:
+    // Collapses ids and query strings so requests group by route
+    static void endpointName(const String& path, char* out, size_t len);
+    static int bucketFor(uint32_t ms);
+    static const char* bucketLabel(int bucket);
+
+    void record(const NetRequestSample& sample);
+    void print(const NetRequestSample& sample);
+    void printSummary();
+    void reset();
+
+    // Copies for display - safe to call while requests are running
+    size_t copyRecent(NetRequestSample* out, size_t max);     // Newest first
+    size_t copyEndpoints(NetEndpointStats* out, size_t max);
+    uint32_t getTotalRequests() { return totalRequests; }
+};
+
+#endif
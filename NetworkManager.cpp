@@ -1,238 +1,654 @@
 #include "NetworkManager.h"
+#include "ContentParser.h"
+#include "ContentStore.h"
+#include <esp_netif.h>
+#include <esp_system.h>
+#include <lwip/dhcp.h>
+#include <time.h>
 
-void SENetworkManager::connect() {
-    WiFi.begin(WIFI_SSID, WIFI_PASS);
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
-    }
-    if (WiFi.status() == WL_CONNECTED) {
-        connected = true;
-        Serial.println("\nWiFi Connected!");
+// ===================================================================================
+// WIFI CONNECT
+// ===================================================================================
+
+static uint32_t hashSsid(const char* ssid) {
+    uint32_t h = 2166136261u;  // FNV-1a
+    while (*ssid) h = (h ^ (uint8_t)*ssid++) * 16777619u;
+    return h;
+}
+
+// Splits "http://host:port/..." into host and port (80 if none)
+static void splitUrl(const String& url, String& host, uint16_t& port) {
+    host = url.substring(url.indexOf("://") + 3);
+    int slash = host.indexOf('/');
+    if (slash >= 0) host = host.substring(0, slash);
+    port = 80;
+    int colon = host.indexOf(':');
+    if (colon >= 0) {
+        port = host.substring(colon + 1).toInt();
+        host = host.substring(0, colon);
+    }
+}
+
+// Lease the DHCP server granted on the station interface, 0 if unknown
+static uint32_t dhcpLeaseSeconds() {
+    esp_netif_t* sta = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    struct netif* nif = sta ? (struct netif*)esp_netif_get_netif_impl(sta) : nullptr;
+    struct dhcp* dhcp = nif ? netif_dhcp_data(nif) : nullptr;
+    return dhcp ? dhcp->offered_t0_lease : 0;
+}
+
+// A cached address is reused only within the first half of its lease (the
+// point a DHCP client would renew). The RTC clock runs through deep sleep
+// and soft resets but restarts on power-up, when the lease age is unknown.
+static bool leaseIsFresh(const WifiCache& cache) {
+    esp_reset_reason_t reason = esp_reset_reason();
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT) return false;
+    time_t now = time(nullptr);
+    if (cache.leaseSeconds == 0 || now < (time_t)cache.savedAt) return false;
+    return (uint32_t)(now - cache.savedAt) < cache.leaseSeconds / 2;
+}
+
+bool SENetworkManager::connect(void (*idle)()) {
+    unsigned long t0 = millis();
+    WiFi.mode(WIFI_STA);
+    WiFi.persistent(false);  // Our own cache below - skip the SDK's flash writes
+
+    lastConnectFast = false;
+    WifiCache cache;
+    if (loadWifiCache(cache)) {
+        // Known channel + BSSID skips the scan; a fresh lease skips DHCP too
+        bool reuseLease = leaseIsFresh(cache);
+        if (reuseLease) {
+            WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+        } else {
+            Serial.println("[WIFI] Cached lease stale or of unknown age, using DHCP");
+        }
+        WiFi.begin(WIFI_SSID, WIFI_PASS, cache.channel, cache.bssid);
+        // Associating says nothing about the address - check it still routes
+        if (waitForWiFi(WIFI_FAST_TIMEOUT_MS, idle) && (!reuseLease || probeAddress())) {
+            lastConnectFast = true;
+            if (!reuseLease) saveWifiCache();  // New lease
+        } else {
+            // AP moved, or the address was given away - forget both and
+            // retry with a full scan and DHCP
+            Serial.println("[WIFI] Fast reconnect failed, scanning with DHCP");
+            clearWifiCache();
+            WiFi.disconnect();
+            WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);  // Back to DHCP
+        }
+    }
+
+    if (!lastConnectFast) {
+        WiFi.begin(WIFI_SSID, WIFI_PASS);
+        if (waitForWiFi(WIFI_FULL_TIMEOUT_MS, idle)) saveWifiCache();
+    }
+
+    connected = isConnected();
+    lastConnectMs = millis() - t0;
+    if (connected) {
+        Serial.printf("[WIFI] Connected in %lu ms (%s), IP %s, ch %d\n", lastConnectMs,
+                      lastConnectFast ? "fast" : "full scan", WiFi.localIP().toString().c_str(), WiFi.channel());
+    } else {
+        Serial.printf("[WIFI] Connection failed after %lu ms\n", lastConnectMs);
+    }
+    return connected;
+}
+
+bool SENetworkManager::waitForWiFi(uint32_t timeoutMs, void (*idle)()) {
+    unsigned long start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs) {
+        if (idle) idle();
+        delay(20);
+    }
+    return WiFi.status() == WL_CONNECTED;
+}
+
+// One DNS lookup (or, for an IP literal, a TCP connect) to the API host
+// through the cached gateway and DNS server
+bool SENetworkManager::probeAddress() {
+    String host;
+    uint16_t port;
+    splitUrl(settingsMgr.getApiBaseUrl(), host, port);
+
+    IPAddress ip;
+    bool ok;
+    if (ip.fromString(host)) {
+        WiFiClient probe;
+        ok = probe.connect(ip, port, WIFI_PROBE_TIMEOUT_MS);
+        probe.stop();
     } else {
-        Serial.println("\nWiFi Connection Failed.");
+        ok = WiFi.hostByName(host.c_str(), ip);
     }
+    if (!ok) Serial.printf("[WIFI] Cached address %s cannot reach %s\n", WiFi.localIP().toString().c_str(), host.c_str());
+    return ok;
+}
+
+bool SENetworkManager::loadWifiCache(WifiCache& cache) {
+    Preferences prefs;
+    if (!prefs.begin("wificache", true)) return false;
+    size_t len = prefs.getBytes("ap", &cache, sizeof(cache));
+    prefs.end();
+    return len == sizeof(cache) && cache.version == WIFI_CACHE_VERSION &&
+           cache.ssidHash == hashSsid(WIFI_SSID) && cache.ip != 0;
+}
+
+void SENetworkManager::saveWifiCache() {
+    WifiCache cache = {};
+    cache.version = WIFI_CACHE_VERSION;
+    cache.channel = WiFi.channel();
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.ssidHash = hashSsid(WIFI_SSID);
+    cache.ip = (uint32_t)WiFi.localIP();
+    cache.gateway = (uint32_t)WiFi.gatewayIP();
+    cache.subnet = (uint32_t)WiFi.subnetMask();
+    cache.dns = (uint32_t)WiFi.dnsIP();
+    cache.leaseSeconds = dhcpLeaseSeconds();
+    cache.savedAt = time(nullptr);
+
+    Preferences prefs;
+    if (!prefs.begin("wificache", false)) return;
+    prefs.putBytes("ap", &cache, sizeof(cache));
+    prefs.end();
+}
+
+void SENetworkManager::clearWifiCache() {
+    Preferences prefs;
+    if (!prefs.begin("wificache", false)) return;
+    prefs.clear();
+    prefs.end();
 }
 
 bool SENetworkManager::isConnected() {
     return WiFi.status() == WL_CONNECTED;
 }
 
-std::vector<ExamMetadata> SENetworkManager::fetchExamList() {
-    std::vector<ExamMetadata> exams;
-    if (!isConnected()) {
-        Serial.println("[NET] Not connected to WiFi");
-        return exams;
+// ===================================================================================
+// BACKGROUND WORKER
+// ===================================================================================
+
+struct NetJob {
+    NetJobId id;
+    NetJobFn work;
+};
+
+void SENetworkManager::startWorker() {
+    if (jobQueue) return;
+
+    sessionLock = xSemaphoreCreateMutex();
+    jobQueue = xQueueCreate(NET_WORKER_QUEUE_LEN, sizeof(NetJob*));
+    if (!sessionLock || !jobQueue) {
+        Serial.println("[NET] Worker allocation failed - requests stay on the main loop");
+        jobQueue = nullptr;
+        return;
     }
 
-    HTTPClient http;
-    String url = settingsMgr.getApiBaseUrl() + "/exams";
-    Serial.println("[NET] Fetching exam list...");
-    
-    WiFiClient client;
-    http.begin(client, url);
-    http.setTimeout(10000);
-    
-    int httpCode = http.GET();
-    Serial.printf("[NET] Response: %d\n", httpCode);
+    // Core 0 runs the WiFi stack; loop() and LVGL stay on core 1
+    if (xTaskCreatePinnedToCore(workerTask, "net_worker", NET_WORKER_STACK, this,
+                                NET_WORKER_PRIORITY, nullptr, NET_WORKER_CORE) != pdPASS) {
+        Serial.println("[NET] Worker task failed to start");
+        vQueueDelete(jobQueue);
+        jobQueue = nullptr;
+        return;
+    }
+    Serial.printf("[NET] Worker started on core %d\n", NET_WORKER_CORE);
+}
 
-    if (httpCode == 200) {
-        String payload = http.getString();
-        Serial.print("[NET] Response: ");
-        Serial.println(payload);
-        
-        DynamicJsonDocument doc(4096);
-        DeserializationError error = deserializeJson(doc, payload);
-        
-        if (error) {
-            Serial.print("[NET] JSON Parse Error: ");
-            Serial.println(error.c_str());
-        } else {
-            JsonArray arr = doc.as<JsonArray>();
-            for (JsonObject obj : arr) {
-                ExamMetadata meta;
-                meta.id = obj["id"].as<String>();
-                meta.title = obj["title"].as<String>();
-                exams.push_back(meta);
-                Serial.print("[NET] Found exam: ");
-                Serial.println(meta.title);
-            }
+void SENetworkManager::workerTask(void* arg) {
+    SENetworkManager* self = static_cast<SENetworkManager*>(arg);
+    NetJob* job = nullptr;
+    for (;;) {
+        if (xQueueReceive(self->jobQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+        unsigned long t0 = millis();
+        job->work();
+        self->lastCompletedJob = job->id;
+        if (settingsMgr.getVerboseNetwork()) {
+            Serial.printf("[NET] Job %lu done in %lu ms\n", job->id, millis() - t0);
         }
-    } else if (httpCode < 0) {
-        Serial.print("[NET] Connection failed: ");
-        Serial.println(http.errorToString(httpCode));
+        delete job;
     }
-    http.end();
-    return exams;
 }
 
-String SENetworkManager::fetchExamJson(String examId) {
-    if (!isConnected()) {
-        Serial.println("[NET] Not connected - cannot fetch exam");
-        return "";
+NetJobId SENetworkManager::submitJob(NetJobFn work) {
+    NetJobId id = ++lastSubmittedJob;
+
+    if (!jobQueue) {
+        work();
+        lastCompletedJob = id;
+        return id;
+    }
+
+    NetJob* job = new NetJob{id, work};
+    // Blocks only if NET_WORKER_QUEUE_LEN jobs are already waiting
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+    return id;
+}
+
+// ===================================================================================
+// KEEP-ALIVE SESSION
+// ===================================================================================
+
+bool SENetworkManager::ensureSessionConnected(const String& host, uint16_t port, uint32_t timeoutMs) {
+    // API URL was edited in dev mode - drop the old socket
+    if (sessionClient.connected() && (host != sessionHost || port != sessionPort)) {
+        Serial.println("[NET] API host changed, closing session");
+        sessionClient.stop();
+    }
+
+    if (sessionClient.connected()) {
+        sessionStats.reused++;
+        sessionStats.lastReused = true;
+        return true;
+    }
+
+    // Resolve separately so DNS and TCP connect are timed on their own
+    unsigned long t0 = millis();
+    IPAddress ip;
+    if (!ip.fromString(host) && !WiFi.hostByName(host.c_str(), ip)) {
+        sessionStats.failedConnects++;
+        Serial.printf("[NET] DNS lookup for %s failed\n", host.c_str());
+        return false;
+    }
+    currentSample.dnsMs = millis() - t0;
+
+    t0 = millis();
+    if (!sessionClient.connect(ip, port, timeoutMs)) {
+        sessionStats.failedConnects++;
+        Serial.printf("[NET] Connect to %s:%d failed\n", host.c_str(), port);
+        return false;
     }
+    sessionClient.setNoDelay(true);
+
+    uint32_t connectMs = millis() - t0;
+    currentSample.connectMs = connectMs;
+    sessionStats.connects++;
+    sessionStats.connectMsTotal += connectMs;
+    sessionStats.lastReused = false;
+    sessionHost = host;
+    sessionPort = port;
+    Serial.printf("[NET] Session opened to %s:%d in %lu ms\n", host.c_str(), port, connectMs);
+    return true;
+}
 
-    String url = settingsMgr.getApiBaseUrl() + "/exams/" + examId;
-    Serial.printf("[NET] Downloading exam from: %s\n", url.c_str());
-    
-    WiFiClient client;
-    HTTPClient http;
-    
-    if (!http.begin(client, url)) {
+bool SENetworkManager::beginRequest(const String& path, uint32_t timeoutMs) {
+    // Held until endRequest() - one request on the shared socket at a time
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    if (sessionLock && lockOwner != self) {
+        xSemaphoreTake(sessionLock, portMAX_DELAY);
+        lockOwner = self;
+    }
+
+    String url = settingsMgr.getApiBaseUrl() + path;
+
+    // Split out host and port so the socket can be opened (or reused) here;
+    // HTTPClient skips its own connect when the client is already connected.
+    String host;
+    uint16_t port;
+    splitUrl(url, host, port);
+
+    requestStart = millis();
+    sessionStats.requests++;
+    memset(&currentSample, 0, sizeof(currentSample));
+    NetStats::endpointName(path, currentSample.endpoint, sizeof(currentSample.endpoint));
+    strlcpy(currentSample.method, "GET", sizeof(currentSample.method));
+    currentSample.status = HTTPC_ERROR_CONNECTION_REFUSED;
+    sampleOpen = true;
+    if (!ensureSessionConnected(host, port, timeoutMs)) return false;
+
+    http.setReuse(true);
+    if (!http.begin(sessionClient, url)) {
         Serial.println("[NET] HTTP begin failed");
-        return "";
-    }
-    
-    http.setTimeout(15000);  // 15 second timeout
-    http.setConnectTimeout(10000);  // 10 second connect timeout
-    
-    Serial.println("[NET] Sending GET request...");
-    int httpCode = http.GET();
-    Serial.printf("[NET] Response code: %d\n", httpCode);
-    
-    String payload = "";
-    if (httpCode == 200) {
-        payload = http.getString();
-        Serial.printf("[NET] Exam downloaded, size: %d bytes\n", payload.length());
-    } else if (httpCode < 0) {
-        Serial.printf("[NET] Connection error: %s\n", http.errorToString(httpCode).c_str());
-    } else {
-        Serial.printf("[NET] HTTP error: %d\n", httpCode);
+        return false;
     }
+    http.setTimeout(timeoutMs);
+
+    // Validator for conditional requests, the body encoding the server chose,
+    // and list paging
+    static const char* collected[] = {"ETag", "Content-Type", "X-Next-Cursor", "X-Total-Count"};
+    http.collectHeaders(collected, 4);
+    return true;
+}
+
+void SENetworkManager::endRequest(bool keepAlive) {
+    // end() leaves the socket open when the server agreed to keep-alive
+    if (!keepAlive) sessionClient.stop();
     http.end();
-    return payload;
+    sessionStats.lastRequestMs = millis() - requestStart;
+
+    if (sampleOpen) {
+        sampleOpen = false;
+        currentSample.reused = sessionStats.lastReused;
+        netStats.record(currentSample);
+        if (settingsMgr.getVerboseNetwork()) netStats.print(currentSample);
+    }
+
+    // The retry path in sendRequest may end twice - only the owner releases
+    if (sessionLock && lockOwner == xTaskGetCurrentTaskHandle()) {
+        lockOwner = nullptr;
+        xSemaphoreGive(sessionLock);
+    }
 }
 
-bool SENetworkManager::uploadResult(String jsonPayload) {
-    if (!isConnected()) return false;
+void SENetworkManager::printSessionStats() {
+    Serial.printf("[NET] Session: %lu requests, %lu reused, %lu connects (%lu failed), avg connect %lu ms, ~%lu ms saved\n",
+                  sessionStats.requests, sessionStats.reused, sessionStats.connects,
+                  sessionStats.failedConnects, sessionStats.avgConnectMs(),
+                  sessionStats.estimatedSavedMs());
+}
 
-    WiFiClient client;
-    HTTPClient http;
-    http.begin(client, settingsMgr.getApiBaseUrl() + "/results");
-    http.addHeader("Content-Type", "application/json");
-    
-    int httpCode = http.POST(jsonPayload);
-    http.end();
-    
-    return (httpCode == 200 || httpCode == 201);
+int SENetworkManager::sendRequest(const char* method, const String& path, const String& body, uint32_t timeoutMs,
+                                  const String& ifNoneMatch, const char* accept) {
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (!beginRequest(path, timeoutMs)) return HTTPC_ERROR_CONNECTION_REFUSED;
+        if (strcmp(method, "POST") == 0) http.addHeader("Content-Type", "application/json");
+        if (ifNoneMatch.length() > 0) http.addHeader("If-None-Match", ifNoneMatch);
+        if (accept) http.addHeader("Accept", accept);
+
+        strlcpy(currentSample.method, method, sizeof(currentSample.method));
+        unsigned long t0 = millis();
+        int httpCode = http.sendRequest(method, body);
+        currentSample.ttfbMs = millis() - t0;
+        currentSample.status = httpCode;
+        if (httpCode > 0 || !sessionStats.lastReused) return httpCode;
+
+        // The server closed the idle socket under us - retry once on a fresh one
+        Serial.println("[NET] Stale keep-alive socket, reconnecting");
+        endRequest(false);
+    }
+    return HTTPC_ERROR_CONNECTION_LOST;
 }
 
-std::vector<Deck> SENetworkManager::fetchDeckList() {
-    std::vector<Deck> decks;
-    if (!isConnected()) return decks;
+// Body read straight off the socket: time blocked on bytes is transfer,
+// the rest went to parsing (and storing) in between reads
+void SENetworkManager::finishBody(TimedStream& body) {
+    uint32_t elapsed = body.elapsedMs();
+    currentSample.bytes = body.bytesRead();
+    currentSample.transferMs = min(body.waitMs(), elapsed);
+    currentSample.parseMs = elapsed - currentSample.transferMs;
+}
 
-    WiFiClient client;
-    HTTPClient http;
-    http.begin(client, settingsMgr.getApiBaseUrl() + "/decks");
-    int httpCode = http.GET();
+int SENetworkManager::get(const String& path, String& response, uint32_t timeoutMs) {
+    response = "";
+    if (!isConnected()) return -1;
 
-    if (httpCode == 200) {
-        String payload = http.getString();
-        DynamicJsonDocument doc(4096);
-        deserializeJson(doc, payload);
-        JsonArray arr = doc.as<JsonArray>();
-        for (JsonObject obj : arr) {
-            Deck d;
-            d.id = obj["id"].as<String>();
-            d.title = obj["title"].as<String>();
-            decks.push_back(d);
-        }
+    int httpCode = sendRequest("GET", path, "", timeoutMs);
+    if (httpCode > 0) {
+        unsigned long t0 = millis();
+        response = http.getString();
+        currentSample.transferMs = millis() - t0;
+        currentSample.bytes = response.length();
     }
-    http.end();
-    return decks;
+    endRequest(httpCode > 0);
+    return httpCode;
 }
 
-Deck SENetworkManager::fetchDeck(String deckId) {
-    Deck deck;
-    if (!isConnected()) return deck;
+int SENetworkManager::post(const String& path, const String& body, String& response, uint32_t timeoutMs) {
+    response = "";
+    if (!isConnected()) return -1;
 
-    WiFiClient client;
-    HTTPClient http;
-    http.begin(client, settingsMgr.getApiBaseUrl() + "/decks/" + deckId);
-    int httpCode = http.GET();
+    int httpCode = sendRequest("POST", path, body, timeoutMs);
+    if (httpCode > 0) {
+        unsigned long t0 = millis();
+        response = http.getString();
+        currentSample.transferMs = millis() - t0;
+        currentSample.bytes = response.length();
+    }
+    endRequest(httpCode > 0);
+    return httpCode;
+}
 
-    if (httpCode == 200) {
-        String payload = http.getString();
-        DynamicJsonDocument doc(16384); // Increase buffer for larger decks
-        deserializeJson(doc, payload);
-        
-        deck.id = doc["id"].as<String>();
-        deck.title = doc["title"].as<String>();
-        
-        JsonArray cards = doc["cards"];
-        for (JsonObject c : cards) {
-            Flashcard f;
-            f.front = c["front"].as<String>();
-            f.back = c["back"].as<String>();
-            f.rating = 0;
-            deck.cards.push_back(f);
+// ===================================================================================
+// PARSE FILTERS
+// ===================================================================================
+// ArduinoJson filters for the list bodies parsed here (content bodies have
+// theirs in ContentParser.cpp). Fields marked true are stored; everything
+// else is skipped as it is read. Each is built once on first use.
+
+static JsonVariantConst catalogItemFilter() {
+    static const StaticJsonDocument<64> filter = [] {
+        StaticJsonDocument<64> f;
+        f["id"] = true;
+        f["title"] = true;
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
+}
+
+static JsonVariantConst manifestFilter() {
+    static const StaticJsonDocument<384> filter = [] {
+        StaticJsonDocument<384> f;
+        for (const char* list : {"exams", "decks", "quizzes"}) {
+            JsonObject entry = f[list].createNestedObject();
+            entry["id"] = true;
+            entry["title"] = true;
+            entry["version"] = true;
+            entry["size"] = true;
         }
-    }
-    http.end();
-    return deck;
+        return f;
+    }();
+    return filter.as<JsonVariantConst>();
 }
 
-std::vector<Quiz> SENetworkManager::fetchQuizList() {
-    std::vector<Quiz> quizzes;
-    if (!isConnected()) return quizzes;
+// ===================================================================================
+// API CALLS
+// ===================================================================================
 
-    WiFiClient client;
-    HTTPClient http;
-    http.begin(client, settingsMgr.getApiBaseUrl() + "/quizzes");
-    int httpCode = http.GET();
+template <typename BodyHandler>
+FetchResult SENetworkManager::fetchConditional(ContentKind kind, const String& id, const String& path,
+                                               uint32_t timeoutMs, BodyHandler onBody, const char* accept) {
+    if (!isConnected()) return FETCH_FAILED;
 
-    if (httpCode == 200) {
-        String payload = http.getString();
-        DynamicJsonDocument doc(4096);
-        deserializeJson(doc, payload);
-        JsonArray arr = doc.as<JsonArray>();
-        for (JsonObject obj : arr) {
-            Quiz q;
-            q.id = obj["id"].as<String>();
-            q.title = obj["title"].as<String>();
-            quizzes.push_back(q);
+    // Only revalidate when there is a cached copy to fall back on
+    String etag = contentStore.loadEtag(kind, id);
+    int httpCode = sendRequest("GET", path, "", timeoutMs, etag, accept);
+    FetchResult result = FETCH_FAILED;
+    bool complete = true;
+    WireFormat format = WIRE_JSON;
+
+    if (httpCode == 304) {
+        result = FETCH_NOT_MODIFIED;
+    } else if (httpCode == 200) {
+        String newEtag = http.header("ETag");
+        // Older backends ignore Accept and answer JSON - the body says which
+        if (http.header("Content-Type").indexOf("msgpack") >= 0) format = WIRE_MSGPACK;
+        TimedStream stream(http.getStream());
+        complete = onBody(stream, format);
+        finishBody(stream);
+        if (complete) {
+            contentStore.saveEtag(kind, id, newEtag);
+            result = FETCH_UPDATED;
         }
+    } else if (httpCode < 0) {
+        Serial.printf("[NET] Connection error: %s\n", HTTPClient::errorToString(httpCode).c_str());
+    } else {
+        Serial.printf("[NET] HTTP error: %d\n", httpCode);
     }
-    http.end();
-    return quizzes;
+
+    // A partially read body would corrupt the next response on this socket
+    endRequest(httpCode > 0 && complete);
+    Serial.printf("[NET] GET %s -> %d (%s, %s, %s, %lu ms)\n", path.c_str(), httpCode,
+                  result == FETCH_NOT_MODIFIED ? "not modified" : (result == FETCH_UPDATED ? "updated" : "failed"),
+                  format == WIRE_MSGPACK ? "msgpack" : "json",
+                  sessionStats.lastReused ? "reused" : "new connection", sessionStats.lastRequestMs);
+    return result;
+}
+
+// Questions go straight from the socket into a pack on flash, one at a time
+bool SENetworkManager::syncExam(const String& examId) {
+    Serial.printf("[NET] Downloading exam: %s\n", examId.c_str());
+    FetchResult result = fetchConditional(CONTENT_EXAM, examId, "/exams/" + examId, 15000,
+        [&](Stream& body, WireFormat format) {
+            return contentStore.spoolExam(examId, [&](PackSpooler& spool, ExamData& exam) {
+                bool complete = parseExamStream(body, exam, [&](const Question& q) { spool.addQuestion(q); }, format);
+                if (!complete) {
+                    Serial.printf("[NET] Exam stream incomplete (%u questions spooled)\n", spool.count());
+                }
+                return complete;
+            });
+        }, NET_ACCEPT_MSGPACK);
+    return result != FETCH_FAILED;
+}
+
+bool SENetworkManager::uploadResult(String jsonPayload) {
+    String response;
+    int httpCode = post("/results", jsonPayload, response, 10000);
+    return (httpCode == 200 || httpCode == 201);
+}
+
+int SENetworkManager::uploadResultBatch(const String& batchJson) {
+    String response;
+    int httpCode = post("/results/batch", batchJson, response, 15000);
+    if (httpCode != 200) {
+        Serial.printf("[NET] Result batch upload failed: %d\n", httpCode);
+    } else {
+        Serial.printf("[NET] Result batch uploaded: %s\n", response.c_str());
+    }
+    return httpCode;
+}
+
+FetchResult SENetworkManager::revalidateDeck(const String& deckId, Deck& deck) {
+    bool complete = false;
+    FetchResult result = fetchConditional(CONTENT_DECK, deckId, "/decks/" + deckId, 15000,
+        [&](Stream& body, WireFormat format) {
+            // Parse straight off the socket - no intermediate String copy
+            complete = parseDeckStream(body, deck, format);
+            if (!complete) {
+                Serial.printf("[NET] Deck stream incomplete (%d cards parsed)\n", deck.cards.size());
+            }
+            Serial.printf("[NET] Deck loaded: %d cards, %u B text in %u blocks, free heap: %d\n",
+                          deck.cards.size(), deck.text.used(), deck.text.blocks(), ESP.getFreeHeap());
+            return complete && contentStore.saveDeck(deck);
+        }, NET_ACCEPT_MSGPACK);
+    // Never hand on part of a deck. A complete one is kept even when saving
+    // it failed (FETCH_FAILED), so the caller can still show it.
+    if (!complete) deck.clear();
+    return result;
+}
+
+Deck SENetworkManager::fetchDeck(String deckId) {
+    Deck deck;
+    if (revalidateDeck(deckId, deck) == FETCH_NOT_MODIFIED) {
+        contentStore.loadDeck(deckId, deck);
+    }
+    return deck;
+}
+
+bool SENetworkManager::syncDeck(const String& deckId, Deck* parsed) {
+    if (parsed) return revalidateDeck(deckId, *parsed) != FETCH_FAILED;
+    Deck deck;  // Parsed only to be packed; dropped on return
+    return revalidateDeck(deckId, deck) != FETCH_FAILED;
+}
+
+FetchResult SENetworkManager::revalidateQuiz(const String& quizId, Quiz& quiz) {
+    bool complete = false;
+    FetchResult result = fetchConditional(CONTENT_QUIZ, quizId, "/quizzes/" + quizId, 15000,
+        [&](Stream& body, WireFormat format) {
+            complete = parseQuizStream(body, quiz, format);
+            if (!complete) {
+                Serial.printf("[NET] Quiz stream incomplete (%d questions parsed)\n", quiz.questions.size());
+            }
+            Serial.printf("[NET] Quiz loaded: %d questions, %u B text in %u blocks, free heap: %d\n",
+                          quiz.questions.size(), quiz.text.used(), quiz.text.blocks(), ESP.getFreeHeap());
+            return complete && contentStore.saveQuiz(quiz);
+        }, NET_ACCEPT_MSGPACK);
+    // Same rule as decks - a quiz cut off mid-body is never returned
+    if (!complete) quiz.clear();
+    return result;
 }
 
 Quiz SENetworkManager::fetchQuiz(String quizId) {
     Quiz quiz;
-    if (!isConnected()) return quiz;
+    if (revalidateQuiz(quizId, quiz) == FETCH_NOT_MODIFIED) {
+        contentStore.loadQuiz(quizId, quiz);
+    }
+    return quiz;
+}
 
-    WiFiClient client;
-    HTTPClient http;
-    http.begin(client, settingsMgr.getApiBaseUrl() + "/quizzes/" + quizId);
-    int httpCode = http.GET();
+bool SENetworkManager::fetchManifest(Manifest& manifest) {
+    if (!isConnected()) return false;
+
+    int httpCode = sendRequest("GET", "/manifest", "", 10000);
+    bool complete = false;
 
     if (httpCode == 200) {
-        String payload = http.getString();
-        DynamicJsonDocument doc(16384);
-        deserializeJson(doc, payload);
-        
-        quiz.id = doc["id"].as<String>();
-        quiz.title = doc["title"].as<String>();
-        
-        JsonArray questions = doc["questions"];
-        for (JsonObject qObj : questions) {
-            QuizQuestion q;
-            q.id = qObj["id"];
-            q.type = qObj["type"].as<String>();
-            q.text = qObj["text"].as<String>();
-            q.correctAnswer = qObj["correct_answer"].as<String>();
-            
-            if (qObj.containsKey("options")) {
-                JsonArray opts = qObj["options"];
-                for (JsonVariant opt : opts) {
-                    q.options.push_back(opt.as<String>());
+        DynamicJsonDocument doc(8192);
+        TimedStream stream(http.getStream());
+        DeserializationError error = deserializeJson(doc, stream, DeserializationOption::Filter(manifestFilter()));
+        finishBody(stream);
+        if (error) {
+            Serial.printf("[NET] Manifest parse error: %s\n", error.c_str());
+        } else {
+            auto readEntries = [](JsonArray arr, std::vector<ManifestEntry>& out) {
+                for (JsonObject obj : arr) {
+                    ManifestEntry e;
+                    e.id = obj["id"].as<String>();
+                    e.title = obj["title"].as<String>();
+                    e.version = obj["version"].as<String>();
+                    e.size = obj["size"] | 0;
+                    out.push_back(e);
                 }
-            }
-            quiz.questions.push_back(q);
+            };
+            readEntries(doc["exams"], manifest.exams);
+            readEntries(doc["decks"], manifest.decks);
+            readEntries(doc["quizzes"], manifest.quizzes);
+            complete = true;
         }
+    } else {
+        Serial.printf("[NET] Manifest request failed: %d\n", httpCode);
     }
-    http.end();
-    return quiz;
+
+    endRequest(httpCode > 0 && (complete || httpCode != 200));
+    return complete;
+}
+
+// ===================================================================================
+// CATALOG PAGES
+// ===================================================================================
+
+static const char* catalogPath(ContentKind kind) {
+    switch (kind) {
+        case CONTENT_EXAM: return "/exams";
+        case CONTENT_DECK: return "/decks";
+        case CONTENT_QUIZ: return "/quizzes";
+    }
+    return "/exams";
+}
+
+FetchResult SENetworkManager::fetchCatalogPage(ContentKind kind, const String& cursor, CatalogPage& page) {
+    if (!isConnected()) return FETCH_FAILED;
+
+    String path = String(catalogPath(kind)) + "?limit=" + CATALOG_PAGE_SIZE;
+    if (cursor.length() > 0) path += "&cursor=" + cursor;
+
+    // Only the first page revalidates - the stored ETag covers the whole list
+    String etag = cursor.isEmpty() ? contentStore.loadEtag(kind, "") : "";
+    int httpCode = sendRequest("GET", path, "", 10000, etag);
+    FetchResult result = FETCH_FAILED;
+    bool complete = true;
+
+    if (httpCode == 304) {
+        result = FETCH_NOT_MODIFIED;
+    } else if (httpCode == 200) {
+        page.etag = http.header("ETag");
+        page.nextCursor = http.header("X-Next-Cursor");
+        String total = http.header("X-Total-Count");
+        page.totalCount = total.length() ? total.toInt() : -1;
+
+        // Older servers send full models here - keep only what the list shows
+        DynamicJsonDocument doc(CATALOG_ITEM_DOC_SIZE);
+        TimedStream stream(http.getStream());
+        complete = walkJsonArray(stream, doc, catalogItemFilter(), [&](JsonObject obj) {
+            page.items.push_back({obj["id"].as<String>(), obj["title"].as<String>()});
+        });
+        finishBody(stream);
+        if (complete) result = FETCH_UPDATED;
+    } else if (httpCode < 0) {
+        Serial.printf("[NET] Connection error: %s\n", HTTPClient::errorToString(httpCode).c_str());
+    } else {
+        Serial.printf("[NET] HTTP error: %d\n", httpCode);
+    }
+
+    endRequest(httpCode > 0 && complete);
+    Serial.printf("[NET] GET %s -> %d (%d items%s)\n", path.c_str(), httpCode, page.items.size(),
+                  page.nextCursor.length() ? ", more" : "");
+    return result;
 }
@@ -3,19 +3,65 @@
 
 #include "config.h"
 #include "SettingsManager.h"
+#include "NetStats.h"
+#include "StringArena.h"
+#include "ContentPartition.h"
 #include <WiFi.h>
 #include <WiFiClient.h>
 #include <HTTPClient.h>
+#include <Preferences.h>
 #include <ArduinoJson.h>
+#include <functional>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
 
 struct ExamMetadata {
     String id;
     String title;
 };
 
+#define CONTENT_MAX_OPTIONS  4   // Answer slots shown per question
+
+// Content text lives in the owning Deck/Quiz's arena (or, for packs mirrored
+// in the content partition, in mapped flash); the structs below only hold
+// views into it. Clear the item (or let it go out of scope) to free all of
+// its text at once.
+
+enum QuestionKind : uint8_t {
+    QUESTION_MCQ,
+    QUESTION_SHORT_ANSWER
+};
+
+// One exam or quiz question. The answer is resolved once at parse time:
+// an option index for MCQs (-1 = manual grading), the expected text for
+// short answers.
+struct Question {
+    int id;
+    QuestionKind kind = QUESTION_MCQ;
+    uint8_t optionCount = 0;
+    int8_t correctOption = -1;
+    const char* text = "";
+    const char* options[CONTENT_MAX_OPTIONS] = {};
+    const char* correctText = "";
+};
+
+// Exam header only. Questions are spooled to the cached pack on download
+// and paged back in by ExamWindow, so exam size is bounded by flash.
+struct ExamData {
+    String id;
+    String title;
+    int durationMinutes = 30;
+    bool showResultsImmediate = true;
+};
+
+// Receives each exam question as it is parsed; its text is only valid
+// for the duration of the call
+typedef std::function<void(const Question&)> QuestionSink;
+
 struct Flashcard {
-    String front;
-    String back;
+    const char* front = "";
+    const char* back = "";
     int rating; // 0=None, 1=Again, 2=Hard, 3=Good, 4=Easy
 };
 
@@ -23,43 +69,224 @@ struct Deck {
     String id;
     String title;
     std::vector<Flashcard> cards;
-};
+    StringArena text;
+    ContentPin pin;   // Held when the text is read in place from the content partition
 
-struct QuizQuestion {
-    int id;
-    String type; // "mcq" or "short_answer"
-    String text;
-    std::vector<String> options;
-    String correctAnswer;
+    void clear() { cards.clear(); cards.shrink_to_fit(); text.reset(); pin.release(); }
 };
 
 struct Quiz {
     String id;
     String title;
-    std::vector<QuizQuestion> questions;
+    std::vector<Question> questions;
+    StringArena text;
+    ContentPin pin;   // Held when the text is read in place from the content partition
+
+    void clear() { questions.clear(); questions.shrink_to_fit(); text.reset(); pin.release(); }
+};
+
+// One cacheable item as listed by GET /manifest
+struct ManifestEntry {
+    String id;
+    String title;
+    String version;  // Same value as the detail endpoint's ETag
+    uint32_t size;   // Detail body size in bytes
+};
+
+struct Manifest {
+    std::vector<ManifestEntry> exams;
+    std::vector<ManifestEntry> decks;
+    std::vector<ManifestEntry> quizzes;
+};
+
+// Cached resource families, used to key stored validators (ETags)
+enum ContentKind : uint8_t {
+    CONTENT_EXAM,
+    CONTENT_DECK,
+    CONTENT_QUIZ
+};
+
+// Outcome of a conditional (If-None-Match) content request
+enum FetchResult {
+    FETCH_FAILED,        // Offline, HTTP error or truncated body - cache untouched
+    FETCH_NOT_MODIFIED,  // 304 - the cached copy is current
+    FETCH_UPDATED        // 200 - new copy parsed and written to the cache
+};
+
+// One page of a catalog list (GET /exams, /decks, /quizzes with ?limit).
+// Items are parsed one at a time, so a page costs the same whatever the
+// catalog size. Servers without paging answer the whole list as one page.
+struct CatalogPage {
+    std::vector<ExamMetadata> items;   // id + title only
+    String nextCursor;                 // Empty on the last page
+    int totalCount = -1;               // X-Total-Count, -1 if not sent
+    String etag;                       // Covers the whole catalog
+};
+
+#define CATALOG_PAGE_SIZE      20
+#define CATALOG_ITEM_DOC_SIZE  384
+
+// Body encoding of a content response. Detail endpoints are requested as
+// MessagePack; a server without it answers JSON and Content-Type decides.
+enum WireFormat : uint8_t {
+    WIRE_JSON,
+    WIRE_MSGPACK
 };
 
+#define NET_ACCEPT_MSGPACK  "application/msgpack, application/json;q=0.5"
+
+// Per-item document capacity for streamed content. Peak heap while loading a
+// deck or quiz is bounded by the largest single card/question, not the body.
+#define STREAM_FIELD_DOC_SIZE     1024   // One top-level string (id, title) - about 1000 characters
+#define STREAM_CARD_DOC_SIZE      2048
+#define STREAM_QUESTION_DOC_SIZE  3072
+#define EXAM_SCRATCH_ARENA_SIZE   1024   // Text of the one exam question being spooled
+
+// Connection reuse counters for the keep-alive session
+struct SessionStats {
+    uint32_t requests = 0;        // Requests sent through the session
+    uint32_t reused = 0;          // Requests that rode an already-open socket
+    uint32_t connects = 0;        // Fresh TCP handshakes
+    uint32_t failedConnects = 0;
+    uint32_t connectMsTotal = 0;  // Time spent in fresh handshakes
+    uint32_t lastRequestMs = 0;
+    bool lastReused = false;
+
+    // Average handshake cost, used to estimate time saved by reuse
+    uint32_t avgConnectMs() const { return connects ? connectMsTotal / connects : 0; }
+    uint32_t estimatedSavedMs() const { return reused * avgConnectMs(); }
+};
+
+// Last good AP and DHCP lease, kept in NVS so the next boot (or wake from
+// deep sleep) can join on a known channel/BSSID and skip the scan, and skip
+// DHCP too while the lease is fresh
+struct WifiCache {
+    uint8_t version;
+    uint8_t channel;
+    uint8_t bssid[6];
+    uint32_t ssidHash;       // Cache is ignored if WIFI_SSID changes
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t leaseSeconds;   // As granted by the DHCP server, 0 if unknown
+    uint32_t savedAt;        // RTC clock (time()) when the lease was granted
+};
+
+#define WIFI_CACHE_VERSION     2
+#define WIFI_FAST_TIMEOUT_MS   3000    // Directed join from the cache
+#define WIFI_FULL_TIMEOUT_MS   10000   // Full scan + DHCP
+#define WIFI_PROBE_TIMEOUT_MS  1500    // Checks a reused address reaches the backend
+
+// Background worker jobs. Ids increase monotonically and the worker runs
+// jobs in submission order, so a job is done once the completed id reaches it.
+typedef uint32_t NetJobId;
+typedef std::function<void()> NetJobFn;
+
+#define NET_WORKER_CORE        0
+#define NET_WORKER_STACK       8192
+#define NET_WORKER_PRIORITY    1
+#define NET_WORKER_QUEUE_LEN   8
+
 class SENetworkManager {
 private:
     bool connected = false;
+    uint32_t lastConnectMs = 0;
+    bool lastConnectFast = false;
+
+    bool waitForWiFi(uint32_t timeoutMs, void (*idle)());
+    bool loadWifiCache(WifiCache& cache);
+    bool probeAddress();
+    void saveWifiCache();
+    void clearWifiCache();
+
+    // Keep-alive session: one socket to the backend shared by every request.
+    // Reconnects only when the socket dropped or the API URL changed.
+    WiFiClient sessionClient;
+    HTTPClient http;
+    String sessionHost;
+    uint16_t sessionPort = 0;
+    unsigned long requestStart = 0;
+    SessionStats sessionStats;
+
+    // Timing of the request in flight; recorded by endRequest()
+    NetStats netStats;
+    NetRequestSample currentSample;
+    bool sampleOpen = false;
+    void finishBody(TimedStream& body);
+
+    // Worker task on core 0. The session lock serializes the shared socket
+    // between the worker and any request still made directly from loop().
+    QueueHandle_t jobQueue = nullptr;
+    SemaphoreHandle_t sessionLock = nullptr;
+    TaskHandle_t lockOwner = nullptr;
+    volatile NetJobId lastSubmittedJob = 0;
+    volatile NetJobId lastCompletedJob = 0;
+
+    static void workerTask(void* arg);
+
+    bool beginRequest(const String& path, uint32_t timeoutMs);
+    void endRequest(bool keepAlive = true);
+    int sendRequest(const char* method, const String& path, const String& body, uint32_t timeoutMs,
+                    const String& ifNoneMatch = "", const char* accept = nullptr);
+    bool ensureSessionConnected(const String& host, uint16_t port, uint32_t timeoutMs);
+
+    // Conditional GET against the cached copy of (kind, id); an empty id is the list.
+    // `onBody(stream, format)` parses the 200 body and returns true once the new
+    // copy is stored. `accept` asks for a binary body (nullptr = JSON only).
+    template <typename BodyHandler>
+    FetchResult fetchConditional(ContentKind kind, const String& id, const String& path,
+                                 uint32_t timeoutMs, BodyHandler onBody, const char* accept = nullptr);
+    FetchResult revalidateDeck(const String& deckId, Deck& deck);
+    FetchResult revalidateQuiz(const String& quizId, Quiz& quiz);
 
 public:
-    void connect();
+    // Tries a directed reconnect from the cached AP and lease first, then a
+    // full scan with DHCP. `idle` runs while waiting (keeps LVGL animating).
+    bool connect(void (*idle)() = nullptr);
     bool isConnected();
+    uint32_t getLastConnectMs() { return lastConnectMs; }
+    bool wasFastConnect() { return lastConnectFast; }
+
+    // Background worker. Engines submit a job, keep rendering, and poll
+    // isJobDone() from their state machine. Before startWorker() (or if it
+    // fails), submitJob runs the job inline and returns an already-done id.
+    void startWorker();
+    NetJobId submitJob(NetJobFn work);
+    bool isJobDone(NetJobId id) { return (int32_t)(lastCompletedJob - id) >= 0; }
+    bool isBusy() { return lastCompletedJob != lastSubmittedJob; }
     
+    // Catalog lists, a page at a time. An empty cursor asks for the first
+    // page, which revalidates the complete cached list (304) in one request.
+    FetchResult fetchCatalogPage(ContentKind kind, const String& cursor, CatalogPage& page);
+
     // API Calls
-    std::vector<ExamMetadata> fetchExamList();
-    String fetchExamJson(String examId);
+    bool syncExam(const String& examId);   // Refresh cached pack only - open it with ExamWindow
     bool uploadResult(String jsonPayload);
+    int uploadResultBatch(const String& batchJson);   // JSON array of results; returns the HTTP status
     
-    // Flashcard API
-    std::vector<Deck> fetchDeckList();
+    // Flashcard API. fetchDeck/fetchQuiz return the fresh or cached item, or
+    // an empty one when the download failed or was cut off.
     Deck fetchDeck(String deckId);
+    // Refresh the cached pack only. `parsed`, if given, receives the deck when
+    // the body parsed completely (empty otherwise), so a caller can still show
+    // it when the pack cannot be written.
+    bool syncDeck(const String& deckId, Deck* parsed = nullptr);
     
     // Quiz API
-    std::vector<Quiz> fetchQuizList();
     Quiz fetchQuiz(String quizId);
 
+    // Boot sync: every cacheable item with its current version
+    bool fetchManifest(Manifest& manifest);
+
+    // Generic requests over the shared session (used by TranscriptEngine)
+    int get(const String& path, String& response, uint32_t timeoutMs = 10000);
+    int post(const String& path, const String& body, String& response, uint32_t timeoutMs = 10000);
+
+    const SessionStats& getSessionStats() { return sessionStats; }
+    NetStats& getNetStats() { return netStats; }
+    void printSessionStats();
+
     String getApiBaseUrl() { return settingsMgr.getApiBaseUrl(); }
 };
 
@@ -1,4 +1,6 @@
 #include "QuizEngine.h"
+#include "ContentStore.h"
+#include "ContentSync.h"
 #include <Wire.h>
 
 // External feedback functions from main sketch
@@ -17,8 +19,14 @@ void QuizEngine::reset() {
     lastSelectedQuizIndex = -1;
     currentQuestionIndex = 0;
     needsFullRedraw = true;
-    availableQuizzes.clear();
-    currentQuiz.questions.clear();
+    quizCatalog.clear();
+    uiMgr.discardPreparedQuestion();   // Mode switches end here
+    
+    // Frees every question string in one pass (not while the worker is filling it)
+    if (netJob == 0 && !currentQuiz.questions.empty()) {
+        currentQuiz.clear();
+        StringArena::printHeap("Quiz freed");
+    }
     userAnswers.clear();
     currentTextInput = "";
     selectedOption = -1;
@@ -27,15 +35,22 @@ void QuizEngine::reset() {
 void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetworkManager& network, int& systemState) {
     switch (state) {
         case QUIZ_INIT:
-            uiMgr.showLoading("Fetching Quizzes...");
-            display.showStatus("Fetching Quizzes...");
+            if (!quizCatalog.isStarted()) {
+                uiMgr.showLoading("Fetching Quizzes...");
+                display.showStatus("Fetching Quizzes...");
+                
+                // Already synced this session - the store is current, skip the network
+                quizCatalog.start(network, CONTENT_QUIZ, !contentSync.isSynced());
+            }
             
-            availableQuizzes = network.fetchQuizList();
+            // Keep rendering until the first page (or the flash copy) is in
+            quizCatalog.update(network);
+            if (!quizCatalog.isReady()) break;
             
-            if (availableQuizzes.empty()) {
+            if (quizCatalog.size() == 0) {
                 uiMgr.showError("No Quizzes Found!");
                 delay(2000);
-                systemState = 0; // Back to menu
+                systemState = STATE_MENU;
             } else {
                 state = QUIZ_SELECT;
                 lastSelectedQuizIndex = -1;
@@ -45,31 +60,36 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
 
         case QUIZ_SELECT:
             {
-                int newIndex = input.getScrollIndex(availableQuizzes.size());
+                // Later pages land while the list is open
+                if (quizCatalog.update(network)) needsFullRedraw = true;
+                
+                int rowCount = quizCatalog.displayCount();
+                int newIndex = input.getScrollIndex(rowCount);
                 
                 if (newIndex != selectedQuizIndex || needsFullRedraw) {
                     selectedQuizIndex = newIndex;
                     
                     std::vector<const char*> quizNames;
-                    for (size_t i = 0; i < availableQuizzes.size(); i++) {
-                        quizNames.push_back(availableQuizzes[i].title.c_str());
+                    for (int i = 0; i < rowCount; i++) {
+                        quizNames.push_back(quizCatalog.titleAt(i));
                     }
                     
-                    uiMgr.showExamList(quizNames.data(), availableQuizzes.size(), selectedQuizIndex, "Select Quiz");
+                    uiMgr.showExamList(quizNames.data(), rowCount, selectedQuizIndex, "Select Quiz");
                     display.showStatus("Select Quiz");
                     
                     lastSelectedQuizIndex = selectedQuizIndex;
                     needsFullRedraw = false;
                 }
+                quizCatalog.prefetch(network, selectedQuizIndex);
                 
-                if (input.isBtnAPressed()) {
+                if (input.isBtnAPressed() && quizCatalog.isLoaded(selectedQuizIndex)) {
                     state = QUIZ_DOWNLOAD;
                     needsFullRedraw = true;
                     delay(200);
                 }
                 
                 if (input.isBtnBPressed()) {
-                    systemState = 0; // Back to menu
+                    systemState = STATE_MENU;
                     delay(200);
                 }
             }
@@ -77,20 +97,36 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
 
         case QUIZ_DOWNLOAD:
             {
-                uiMgr.showLoading("Downloading Quiz...");
-                display.showStatus("Downloading...");
-                
-                Quiz fullQuiz = network.fetchQuiz(availableQuizzes[selectedQuizIndex].id);
+                if (netJob == 0) {
+                    uiMgr.showLoading("Downloading Quiz...");
+                    display.showStatus("Downloading...");
+                    
+                    // Conditional fetch (a 304 reads the cached pack) on the worker;
+                    // offline or synced, use the cache directly
+                    String quizId = quizCatalog.item(selectedQuizIndex).id;
+                    bool useNetwork = !contentSync.isSynced();
+                    currentQuiz.clear();
+                    StringArena::printHeap("Before quiz load");
+                    netJob = network.submitJob([this, &network, quizId, useNetwork]() {
+                        if (useNetwork) currentQuiz = network.fetchQuiz(quizId);
+                        if (currentQuiz.questions.empty()) contentStore.loadQuiz(quizId, currentQuiz);
+                    });
+                }
+                if (!network.isJobDone(netJob)) break;
+                netJob = 0;
                 
-                if (fullQuiz.questions.empty()) {
+                if (currentQuiz.questions.empty()) {
                     uiMgr.showError("Empty Quiz!");
                     delay(2000);
                     state = QUIZ_SELECT;
                     needsFullRedraw = true;
                 } else {
-                    currentQuiz = fullQuiz;
+                    Serial.printf("[QUIZ] %d questions, %u B text in %u blocks\n", currentQuiz.questions.size(),
+                                  currentQuiz.text.used(), currentQuiz.text.blocks());
+                    StringArena::printHeap("After quiz load");
                     state = QUIZ_RUN;
                     currentQuestionIndex = 0;
+                    uiMgr.discardPreparedQuestion();
                     userAnswers.clear();
                     for(size_t i=0; i<currentQuiz.questions.size(); i++) userAnswers.push_back("");
                     currentTextInput = "";
@@ -122,32 +158,34 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                     if (c != 0) key = c;
                 }
                 
-                QuizQuestion& q = currentQuiz.questions[currentQuestionIndex];
+                Question& q = currentQuiz.questions[currentQuestionIndex];
                 
                 // Debounce timing
                 static unsigned long lastBtnTime = 0;
                 const unsigned long DEBOUNCE = 200;
 
-                if (q.type == "mcq") {
+                if (q.kind == QUESTION_MCQ) {
                     // Handle MCQ
                     if (needsFullRedraw) {
-                        const char* options[4];
-                        for (size_t i = 0; i < q.options.size() && i < 4; i++) {
-                            options[i] = q.options[i].c_str();
-                        }
-                        
                         uiMgr.showQuestion(
                             currentQuestionIndex + 1,
                             currentQuiz.questions.size(),
-                            q.text.c_str(),
-                            options,
-                            q.options.size(),
+                            q.text,
+                            q.options,
+                            q.optionCount,
                             selectedOption,
                             -1 
                         );
                         
                         display.showStatus("Quiz: MCQ");
                         needsFullRedraw = false;
+                    } else if (currentQuestionIndex + 1 < (int)currentQuiz.questions.size()) {
+                        // Idle pass - build the next question's screen so confirming is a swap
+                        const Question& nq = currentQuiz.questions[currentQuestionIndex + 1];
+                        if (nq.kind == QUESTION_MCQ) {
+                            uiMgr.prepareQuestion(currentQuestionIndex + 2, currentQuiz.questions.size(),
+                                                  nq.text, nq.options, nq.optionCount, -1, -1);
+                        }
                     }
                     
                     // Input with debounce
@@ -158,11 +196,12 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                         else if (btnCPressed) newSelection = 2;
                         else if (btnDPressed) newSelection = 3;
                         
-                        if (newSelection != -1 && newSelection < (int)q.options.size()) {
+                        if (newSelection != -1 && newSelection < (int)q.optionCount) {
                             lastBtnTime = millis();
                             if (newSelection == selectedOption) {
                                 // Confirm selection if pressed again
                                 beepClick(); // Confirmation click
+                                uiMgr.markInput();
                                 userAnswers[currentQuestionIndex] = String(selectedOption);
                                 currentQuestionIndex++;
                                 selectedOption = -1;
@@ -182,6 +221,7 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                     if (key == 13) { // Enter
                         if (selectedOption != -1) {
                             beepClick(); // Confirm click
+                            uiMgr.markInput();
                             userAnswers[currentQuestionIndex] = String(selectedOption);
                             currentQuestionIndex++;
                             selectedOption = -1;
@@ -205,7 +245,7 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                         uiMgr.showQuizQuestionText(
                             currentQuestionIndex + 1,
                             currentQuiz.questions.size(),
-                            q.text.c_str(),
+                            q.text,
                             currentTextInput.c_str(),
                             cursorVisible
                         );
@@ -326,6 +366,7 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                             needsFullRedraw = true;
                         } else {
                             // Exit
+                            uiMgr.discardPreparedQuestion();
                             state = QUIZ_SELECT;
                             needsFullRedraw = true;
                         }
@@ -359,14 +400,14 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                 if (needsFullRedraw) {
                     int score = 0;
                     for (size_t i = 0; i < currentQuiz.questions.size(); i++) {
-                        String correct = currentQuiz.questions[i].correctAnswer;
-                        String user = userAnswers[i];
+                        const Question& q = currentQuiz.questions[i];
+                        const String& user = userAnswers[i];
                         
-                        if (currentQuiz.questions[i].type == "mcq") {
-                            if (user == correct) score++;
+                        if (q.kind == QUESTION_MCQ) {
+                            if (user.length() > 0 && user.toInt() == q.correctOption) score++;
                         } else {
                             // Case insensitive comparison for text
-                            if (user.equalsIgnoreCase(correct)) score++;
+                            if (user.length() > 0 && user.equalsIgnoreCase(q.correctText)) score++;
                         }
                     }
                     
@@ -426,35 +467,34 @@ void QuizEngine::handleRun(DisplayManager& display, InputManager& input, SENetwo
                 bool btnDPressed = !((pcfRaw >> 3) & 1);
                 
                 if (needsFullRedraw) {
-                    QuizQuestion& q = currentQuiz.questions[reviewQuestionIndex];
-                    String userAns = userAnswers[reviewQuestionIndex];
-                    String correctAns = q.correctAnswer;
+                    Question& q = currentQuiz.questions[reviewQuestionIndex];
+                    const String& userAns = userAnswers[reviewQuestionIndex];
                     bool isCorrect = false;
                     
                     String displayUserAns = userAns;
-                    String displayCorrectAns = correctAns;
+                    String displayCorrectAns = q.correctText;
                     
-                    if (q.type == "mcq") {
+                    if (q.kind == QUESTION_MCQ) {
                         // Convert indices to text
-                        int userIdx = userAns.toInt();
-                        int correctIdx = correctAns.toInt();
+                        int userIdx = userAns.length() > 0 ? userAns.toInt() : -1;
                         
-                        if (userIdx >= 0 && userIdx < (int)q.options.size()) {
+                        if (userIdx >= 0 && userIdx < (int)q.optionCount) {
                             displayUserAns = q.options[userIdx];
                         }
-                        if (correctIdx >= 0 && correctIdx < (int)q.options.size()) {
-                            displayCorrectAns = q.options[correctIdx];
+                        if (q.correctOption >= 0 && q.correctOption < (int)q.optionCount) {
+                            displayCorrectAns = q.options[q.correctOption];
                         }
                         
-                        if (userAns == correctAns) isCorrect = true;
+                        // Unanswered never matches, even when the answer key did not resolve (-1)
+                        isCorrect = userIdx >= 0 && userIdx == q.correctOption;
                     } else {
-                        if (userAns.equalsIgnoreCase(correctAns)) isCorrect = true;
+                        isCorrect = userAns.length() > 0 && userAns.equalsIgnoreCase(q.correctText);
                     }
                     
                     uiMgr.showQuizReview(
                         reviewQuestionIndex + 1,
                         currentQuiz.questions.size(),
-                        q.text.c_str(),
+                        q.text,
                         displayUserAns.c_str(),
                         displayCorrectAns.c_str(),
                         isCorrect
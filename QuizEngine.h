@@ -5,6 +5,7 @@
 #include "DisplayManager.h"
 #include "InputManager.h"
 #include "NetworkManager.h"
+#include "CatalogPager.h"
 #include "UIManager.h"
 #include <vector>
 #include <ArduinoJson.h>
@@ -22,7 +23,7 @@ enum QuizState {
 class QuizEngine {
 private:
     QuizState state = QUIZ_INIT;
-    std::vector<Quiz> availableQuizzes;
+    CatalogPager quizCatalog;
     Quiz currentQuiz;
     
     int selectedQuizIndex = 0;
@@ -32,6 +33,9 @@ private:
     int reviewQuestionIndex = 0; // For review mode
     bool needsFullRedraw = true;
     
+    // In-flight network worker job (0 = none)
+    NetJobId netJob = 0;
+    
     // User answers
     std::vector<String> userAnswers;
     String currentTextInput = "";
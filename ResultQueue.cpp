@@ -0,0 +1,210 @@
+/**
+ * Result Queue Implementation
+ * One file per pending result under /results, written via a temp file and
+ * rename so a power cut never leaves a half-written entry in the queue.
+ */
+
+#include "ResultQueue.h"
+#include <FS.h>
+#include <LittleFS.h>
+#include <WiFi.h>
+
+static const char* RESULT_DIR = "/results";
+static const char* QUARANTINE_DIR = "/results/quarantine";
+
+// Client errors that will fail the same way on every retry
+static bool isRejected(int httpCode) {
+    return httpCode >= 400 && httpCode < 500 && httpCode != 408 && httpCode != 429;
+}
+
+ResultQueue::ResultQueue(SENetworkManager* nm) : netMgr(nm) {}
+
+bool ResultQueue::begin() {
+    if (!LittleFS.exists(RESULT_DIR) && !LittleFS.mkdir(RESULT_DIR)) {
+        Serial.println("[RESULTS] Queue directory unavailable - results upload directly");
+        return false;
+    }
+    if (!LittleFS.exists(QUARANTINE_DIR)) LittleFS.mkdir(QUARANTINE_DIR);
+    ready = true;
+    pending = countPending();
+    if (pending > 0) {
+        Serial.printf("[RESULTS] %d result(s) pending from a previous session\n", pending);
+    }
+    return true;
+}
+
+std::vector<String> ResultQueue::listPending() {
+    std::vector<String> paths;
+    File root = LittleFS.open(RESULT_DIR);
+    if (!root) return paths;
+    File entry = root.openNextFile();
+    while (entry) {
+        String name = entry.name();
+        if (name.endsWith(".json")) paths.push_back(String(RESULT_DIR) + "/" + name);
+        entry = root.openNextFile();
+    }
+    return paths;
+}
+
+int ResultQueue::countPending() {
+    return listPending().size();
+}
+
+// Unique per device and submission - lets the backend drop retried duplicates
+String ResultQueue::newSubmissionId() {
+    uint8_t mac[6];
+    WiFi.macAddress(mac);
+    char id[32];
+    snprintf(id, sizeof(id), "%02x%02x%02x-%08lx-%08x",
+             mac[3], mac[4], mac[5], (unsigned long)millis(), esp_random());
+    return String(id);
+}
+
+bool ResultQueue::enqueue(JsonDocument& result) {
+    if (!ready) return false;
+
+    String submissionId = newSubmissionId();
+    result["submission_id"] = submissionId;
+
+    String path = String(RESULT_DIR) + "/" + submissionId + ".json";
+    String tmpPath = path + ".tmp";
+    File f = LittleFS.open(tmpPath, "w");
+    if (!f) return false;
+    size_t written = serializeJson(result, f);
+    bool ok = written > 0 && !f.getWriteError();
+    f.close();
+
+    if (!ok || !LittleFS.rename(tmpPath, path)) {
+        Serial.println("[RESULTS] Could not persist result (flash full?)");
+        LittleFS.remove(tmpPath);
+        return false;
+    }
+
+    pending = pending + 1;
+    Serial.printf("[RESULTS] Queued %s (%d pending)\n", submissionId.c_str(), pending);
+    return true;
+}
+
+void ResultQueue::update() {
+    if (!ready) return;
+
+    // Finish a flush the worker has completed
+    if (flushJob) {
+        if (!netMgr->isJobDone(flushJob)) return;
+        flushJob = 0;
+
+        if (flushOk) {
+            backoffMs = 0;
+            failedAttempts = 0;
+            nextAttempt = 0;  // Drain the rest of the queue right away
+        } else {
+            // Exponential backoff with jitter so a room full of devices
+            // does not retry against the AP in lockstep
+            backoffMs = backoffMs ? min<uint32_t>(backoffMs * 2, RESULT_BACKOFF_MAX_MS) : RESULT_BACKOFF_MIN_MS;
+            uint32_t jitter = esp_random() % (backoffMs / 4 + 1);
+            nextAttempt = millis() + backoffMs + jitter;
+            failedAttempts++;
+            Serial.printf("[RESULTS] Upload failed (%lu in a row), retry in %lu ms, %d pending\n",
+                          failedAttempts, backoffMs + jitter, pending);
+        }
+    }
+
+    if (pending <= 0 || !netMgr->isConnected()) return;
+    if (nextAttempt && (long)(millis() - nextAttempt) < 0) return;
+
+    flushOk = false;
+    flushJob = netMgr->submitJob([this]() { flushOk = flushBatch(); });
+}
+
+bool ResultQueue::flushBatch() {
+    std::vector<String> paths = listPending();
+    if (paths.empty()) {
+        pending = 0;
+        return true;
+    }
+    if (paths.size() > RESULT_BATCH_MAX) paths.resize(RESULT_BATCH_MAX);
+
+    std::vector<String> sent;
+    std::vector<String> entries;
+    for (const auto& path : paths) {
+        File f = LittleFS.open(path, "r");
+        if (!f) continue;
+        String entry = f.readString();
+        f.close();
+        if (entry.length() == 0) {
+            LittleFS.remove(path);  // Torn entry - nothing to send
+            continue;
+        }
+        sent.push_back(path);
+        entries.push_back(entry);
+    }
+    if (sent.empty()) {
+        pending = countPending();
+        return true;
+    }
+
+    bool ok;
+    if (batchUnsupported) {
+        ok = flushEach(sent, entries);
+    } else {
+        // Entries are already serialized JSON - concatenate them into one array
+        String batch = "[";
+        for (size_t i = 0; i < entries.size(); i++) {
+            if (i > 0) batch += ",";
+            batch += entries[i];
+        }
+        batch += "]";
+
+        int httpCode = netMgr->uploadResultBatch(batch);
+        if (httpCode == 200) {
+            for (const auto& path : sent) LittleFS.remove(path);
+            Serial.printf("[RESULTS] Uploaded batch of %d\n", sent.size());
+            ok = true;
+        } else if (httpCode == 404) {
+            // Older backend without the batch endpoint - one POST each from now on
+            Serial.println("[RESULTS] No batch endpoint, uploading results one at a time");
+            batchUnsupported = true;
+            ok = flushEach(sent, entries);
+        } else if (isRejected(httpCode)) {
+            // One bad entry fails the whole batch - send singly to find it
+            ok = flushEach(sent, entries);
+        } else {
+            ok = false;
+        }
+    }
+    pending = countPending();
+    return ok;
+}
+
+// POST /results per entry. Stops at the first transient failure so the
+// caller backs off; rejected entries are quarantined and skipped.
+bool ResultQueue::flushEach(const std::vector<String>& paths, const std::vector<String>& entries) {
+    int uploaded = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        String response;
+        int httpCode = netMgr->post("/results", entries[i], response, 10000);
+        if (httpCode == 200 || httpCode == 201) {
+            LittleFS.remove(paths[i]);
+            uploaded++;
+        } else if (httpCode != 404 && isRejected(httpCode)) {
+            quarantine(paths[i], httpCode);
+        } else {
+            Serial.printf("[RESULTS] Upload failed: %d\n", httpCode);
+            return false;
+        }
+    }
+    Serial.printf("[RESULTS] Uploaded %d result(s) singly\n", uploaded);
+    return true;
+}
+
+// Keeps a rejected result on flash for manual recovery, out of the queue
+void ResultQueue::quarantine(const String& path, int httpCode) {
+    String name = path.substring(path.lastIndexOf('/') + 1);
+    String dest = String(QUARANTINE_DIR) + "/" + name;
+    if (LittleFS.rename(path, dest)) {
+        Serial.printf("[RESULTS] %s rejected (%d), moved to %s\n", name.c_str(), httpCode, QUARANTINE_DIR);
+    } else {
+        LittleFS.remove(path);
+        Serial.printf("[RESULTS] %s rejected (%d) and dropped - quarantine unavailable\n", name.c_str(), httpCode);
+    }
+}
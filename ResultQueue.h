@@ -0,0 +1,62 @@
+/**
+ * Result Queue - Store-and-forward queue for exam results
+ * Every submission is written to LittleFS before anything touches the
+ * network, then flushed in batches by the network worker with exponential
+ * backoff. A result only leaves flash once the backend acknowledged it, or
+ * once the backend rejected it outright (4xx) - those are moved aside to a
+ * quarantine directory instead of blocking the queue forever.
+ */
+
+#ifndef RESULT_QUEUE_H
+#define RESULT_QUEUE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <vector>
+#include "NetworkManager.h"
+
+#define RESULT_BATCH_MAX        8        // Results per POST /results/batch
+#define RESULT_BACKOFF_MIN_MS   2000
+#define RESULT_BACKOFF_MAX_MS   300000   // 5 minutes
+
+class ResultQueue {
+private:
+    SENetworkManager* netMgr;
+    bool ready = false;
+    volatile int pending = 0;
+    volatile bool batchUnsupported = false;   // Backend answered 404 to /results/batch
+
+    // Upload state - backoff is only touched from update() on the main loop
+    NetJobId flushJob = 0;
+    volatile bool flushOk = false;
+    uint32_t backoffMs = 0;
+    unsigned long nextAttempt = 0;
+    uint32_t failedAttempts = 0;
+
+    std::vector<String> listPending();
+    int countPending();
+    bool flushBatch();   // Runs on the network worker
+    bool flushEach(const std::vector<String>& paths, const std::vector<String>& entries);
+    void quarantine(const String& path, int httpCode);
+    String newSubmissionId();
+
+public:
+    ResultQueue(SENetworkManager* nm);
+
+    bool begin();   // Call after LittleFS is mounted (contentStore.begin)
+    void update();  // Call every loop - starts a flush when due
+
+    // Stamps the result with a submission id and persists it.
+    // Returns false only if the result could not be written to flash.
+    bool enqueue(JsonDocument& result);
+
+    // Skip the current backoff (e.g. right after a new submission). A short
+    // random delay spreads the end-of-exam spike across the room.
+    void flushSoon() { nextAttempt = millis() + esp_random() % 1500; }
+
+    int pendingCount() { return pending; }
+};
+
+extern ResultQueue resultQueue;
+
+#endif
@@ -0,0 +1,87 @@
+/**
+ * String Arena Implementation
+ */
+
+#include "StringArena.h"
+#include <esp_heap_caps.h>
+
+StringArena::StringArena(StringArena&& other) noexcept
+    : head(other.head), blockSize(other.blockSize), blockCount(other.blockCount), bytesUsed(other.bytesUsed) {
+    other.head = nullptr;
+    other.blockCount = 0;
+    other.bytesUsed = 0;
+}
+
+StringArena& StringArena::operator=(StringArena&& other) noexcept {
+    if (this != &other) {
+        reset();
+        head = other.head;
+        blockSize = other.blockSize;
+        blockCount = other.blockCount;
+        bytesUsed = other.bytesUsed;
+        other.head = nullptr;
+        other.blockCount = 0;
+        other.bytesUsed = 0;
+    }
+    return *this;
+}
+
+char* StringArena::alloc(size_t bytes) {
+    if (head && head->size - head->used >= bytes) {
+        char* p = head->data + head->used;
+        head->used += bytes;
+        bytesUsed += bytes;
+        return p;
+    }
+
+    size_t size = bytes > blockSize ? bytes : blockSize;
+    Block* block = (Block*)malloc(sizeof(Block) + size);
+    if (!block) {
+        Serial.printf("[ARENA] Out of memory (%u bytes)\n", sizeof(Block) + size);
+        return nullptr;
+    }
+    block->size = size;
+    block->used = bytes;
+    bytesUsed += bytes;
+    blockCount++;
+
+    // An oversized string fills its block completely - keep filling the
+    // current one afterwards instead of abandoning its free space
+    if (head && size > blockSize) {
+        block->next = head->next;
+        head->next = block;
+    } else {
+        block->next = head;
+        head = block;
+    }
+    return block->data;
+}
+
+char* StringArena::reserve(size_t len) {
+    char* p = alloc(len + 1);
+    if (p) p[len] = '\0';
+    return p;
+}
+
+const char* StringArena::add(const char* s, size_t len) {
+    if (!s || len == 0) return "";
+    char* p = reserve(len);
+    if (!p) return "";
+    memcpy(p, s, len);
+    return p;
+}
+
+void StringArena::reset() {
+    while (head) {
+        Block* next = head->next;
+        free(head);
+        head = next;
+    }
+    blockCount = 0;
+    bytesUsed = 0;
+}
+
+void StringArena::printHeap(const char* label) {
+    Serial.printf("[MEM] %s: free %u, largest block %u\n", label,
+                  ESP.getFreeHeap(), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+}
@@ -0,0 +1,64 @@
+/**
+ * String Arena - Bump allocator that owns the text of one loaded content item
+ * Deck, quiz and exam structs hold `const char*` views into their arena
+ * instead of one heap `String` per field. Text goes into a few large blocks,
+ * so a 300-card deck is a dozen allocations rather than 600+, and reset()
+ * returns all of it in one pass - the heap is left as unfragmented as it was
+ * before the load.
+ */
+
+#ifndef STRING_ARENA_H
+#define STRING_ARENA_H
+
+#include <Arduino.h>
+
+#define ARENA_BLOCK_SIZE  4096   // Default block; longer strings get a block of their own
+
+class StringArena {
+private:
+    struct Block {
+        Block* next;
+        size_t size;
+        size_t used;
+        char data[];
+    };
+
+    Block* head = nullptr;   // Newest block, the one being filled
+    size_t blockSize = ARENA_BLOCK_SIZE;
+    size_t blockCount = 0;
+    size_t bytesUsed = 0;
+
+    char* alloc(size_t bytes);
+
+public:
+    StringArena() = default;
+    explicit StringArena(size_t blockSize) : blockSize(blockSize) {}  // Smaller blocks for short-lived text
+    ~StringArena() { reset(); }
+
+    // Views into the arena must not outlive it - no copies
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+    StringArena(StringArena&& other) noexcept;
+    StringArena& operator=(StringArena&& other) noexcept;
+
+    // Copies `len` bytes plus a NUL into the arena. Empty or failed copies
+    // return "", so callers never see nullptr.
+    const char* add(const char* s, size_t len);
+    const char* add(const char* s) { return s ? add(s, strlen(s)) : ""; }
+    const char* add(const String& s) { return add(s.c_str(), s.length()); }
+
+    // Space for a string of `len` bytes that the caller fills (e.g. straight
+    // from a file). The NUL at [len] is already written.
+    char* reserve(size_t len);
+
+    // Frees every block; all views handed out become invalid
+    void reset();
+
+    size_t used() const { return bytesUsed; }
+    size_t blocks() const { return blockCount; }
+
+    // Free heap and largest free block, for before/after comparisons
+    static void printHeap(const char* label);
+};
+
+#endif
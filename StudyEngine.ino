@@ -11,6 +11,9 @@
 #include "WebManager.h"
 #include "FocusManager.h"
 #include "SettingsManager.h"
+#include "ContentStore.h"
+#include "ContentSync.h"
+#include "ResultQueue.h"
 
 // ===================================================================================
 // GLOBALS
@@ -23,22 +26,8 @@ StudyManager studyMgr;
 FlashcardEngine flashcardEngine;
 QuizEngine quizEngine;
 WebManager webMgr(&networkMgr);
-
-enum SystemState {
-    STATE_MENU,
-    STATE_SETTINGS,
-    STATE_ADMIN_URL,
-    STATE_DEV_MODE,
-    STATE_API_URL_EDIT,
-    STATE_HW_TEST,
-    STATE_SCANATRON_SETUP,
-    STATE_SCANATRON_RUN,
-    STATE_STUDY_TIMER,
-    STATE_FLASHCARDS,
-    STATE_QUIZ,
-    STATE_TRANSCRIPT,
-    STATE_RESULTS
-};
+ContentSync contentSync(&networkMgr);
+ResultQueue resultQueue(&networkMgr);
 
 SystemState currentState = STATE_MENU;
 SystemState lastState = STATE_RESULTS; // Force redraw
@@ -181,6 +170,15 @@ void setup() {
 
     // Init Settings Manager FIRST (loads saved preferences)
     settingsMgr.begin();
+    
+    // Mount the on-flash content cache (works without WiFi)
+    contentStore.begin();
+    
+    // Exam results pending from a previous session are retried from here
+    resultQueue.begin();
+    
+    // HTTP work runs on core 0 so LVGL and input stay live during downloads
+    networkMgr.startWorker();
 
     // Init Managers
     inputMgr.begin();
@@ -199,25 +197,17 @@ void setup() {
     
     displayMgr.showStatus("Connecting WiFi...");
     
-    // Connect WiFi
-    WiFi.begin(WIFI_SSID, WIFI_PASS);
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 40) {
-        uiMgr.update();
-        delay(250);
-        attempts++;
-    }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("[WIFI] Connected");
-        Serial.print("[WIFI] IP: ");
-        Serial.println(WiFi.localIP());
+    // Connect WiFi - cached AP/lease first, full scan as fallback
+    if (networkMgr.connect([]() { uiMgr.update(); })) {
         displayMgr.showStatus("WiFi Connected");
         
         // Start Web Server
         webMgr.begin();
         Serial.print("[WEB] Admin UI at http://");
         Serial.println(WiFi.localIP());
+        
+        // Sync content into the store - runs incrementally from loop()
+        contentSync.start();
     } else {
         Serial.println("[WIFI] Connection Failed");
         displayMgr.showStatus("WiFi Failed");
@@ -234,6 +224,13 @@ void setup() {
 }
 
 void loop() {
+    // Main loop period. Measured here rather than in uiMgr.update(), which
+    // also runs from inside blocking waits and would split a stall in two.
+    uint32_t loopUs = uiMgr.getFrameStats().loopTick();
+    if (loopUs > FRAME_STALL_US && settingsMgr.getShowFPS()) {
+        Serial.printf("[UI] Stall: %lu ms main loop pass\n", loopUs / 1000);
+    }
+    
     // Update LVGL
     uiMgr.update();
     
@@ -243,6 +240,14 @@ void loop() {
     // Update inputs (including long-press detection)
     inputMgr.update();
     
+    // Flush queued exam results (uploads run on the network worker)
+    resultQueue.update();
+    
+    // Background content sync - one worker job at a time, only while idling in menus
+    if (currentState == STATE_MENU || currentState == STATE_SETTINGS) {
+        contentSync.update();
+    }
+    
     // Check Focus Mode (except during Scanatron exam)
     if (currentState != STATE_SCANATRON_RUN && currentState != STATE_SCANATRON_SETUP) {
         if (!focusMgr.checkFocus()) {
@@ -258,7 +263,7 @@ void loop() {
     
     // Global Back Button (BtnB) to return to Menu - ONLY for states that don't handle B themselves
     // Most states handle their own B button, so this is mainly a fallback
-    // DO NOT intercept B for: SCANATRON_RUN, SCANATRON_SETUP, MENU, FLASHCARDS, QUIZ, STUDY_TIMER, SETTINGS
+    // DO NOT intercept B for: SCANATRON_RUN, SCANATRON_SETUP, MENU, FLASHCARDS, QUIZ, STUDY_TIMER, SETTINGS, NET_STATS, TRANSCRIPT
     if (inputMgr.isBtnBPressed() && 
         currentState != STATE_SCANATRON_RUN && 
         currentState != STATE_SCANATRON_SETUP &&  // Added - let setup handle its own B
@@ -266,7 +271,9 @@ void loop() {
         currentState != STATE_FLASHCARDS && 
         currentState != STATE_QUIZ &&
         currentState != STATE_STUDY_TIMER &&
-        currentState != STATE_SETTINGS) {
+        currentState != STATE_SETTINGS &&
+        currentState != STATE_NET_STATS &&
+        currentState != STATE_TRANSCRIPT) {  // B cancels a running generation
         Serial.println("[MAIN] Global B pressed - returning to menu");
         currentState = STATE_MENU;
         lastMenuIndex = -1;  // Force redraw
@@ -300,6 +307,10 @@ void loop() {
         case STATE_HW_TEST:
             handleHardwareTest();
             break;
+            
+        case STATE_NET_STATS:
+            handleNetStats();
+            break;
         case STATE_SCANATRON_SETUP:
             examEngine.handleSetup(displayMgr, inputMgr, networkMgr, stateInt);
             if (stateInt != (int)currentState) {
@@ -468,16 +479,24 @@ void handleAdminURL() {
 }
 
 void handleDevMode() {
-    // Map pot to dev menu (7 items now with Hardware Tests)
-    devMenuIndex = inputMgr.getScrollIndex(7);
+    // Map pot to dev menu (8 items now with Network Stats)
+    devMenuIndex = inputMgr.getScrollIndex(8);
     
     // Redraw if changed
     if (devMenuIndex != lastDevMenuIndex) {
+        char wifiInfo[32];
+        if (networkMgr.getLastConnectMs() > 0) {
+            snprintf(wifiInfo, sizeof(wifiInfo), "WiFi: %lu ms (%s)", networkMgr.getLastConnectMs(),
+                     networkMgr.wasFastConnect() ? "fast" : "scan");
+        } else {
+            snprintf(wifiInfo, sizeof(wifiInfo), "WiFi: -");
+        }
         uiMgr.showDevModeMenu(devMenuIndex, 
                               settingsMgr.getApiBaseUrl().c_str(),
                               settingsMgr.getSerialDebug(),
                               settingsMgr.getShowFPS(),
-                              settingsMgr.getVerboseNetwork());
+                              settingsMgr.getVerboseNetwork(),
+                              wifiInfo);
         lastDevMenuIndex = devMenuIndex;
     }
     
@@ -513,7 +532,11 @@ void handleDevMode() {
                 hwTestIndex = 0;
                 lastHwTestIndex = -1;
                 break;
-            case 5:  // Reset All Settings
+            case 5:  // Network Stats
+                currentState = STATE_NET_STATS;
+                networkMgr.getNetStats().printSummary();
+                break;
+            case 6:  // Reset All Settings
                 settingsMgr.resetApiBaseUrl();
                 settingsMgr.setSerialDebug(true);
                 settingsMgr.setShowFPS(false);
@@ -523,7 +546,7 @@ void handleDevMode() {
                 Serial.println("[DEV] All settings reset to defaults");
                 lastDevMenuIndex = -1;
                 break;
-            case 6:  // Back
+            case 7:  // Back
                 currentState = STATE_SETTINGS;
                 lastSettingsMenuIndex = -1;
                 break;
@@ -540,6 +563,68 @@ void handleDevMode() {
     }
 }
 
+void handleNetStats() {
+    static unsigned long lastRedraw = 0;
+    static bool shown = false;
+    
+    // Live view - refresh once a second while requests come in
+    if (!shown || millis() - lastRedraw > 1000) {
+        NetStats& stats = networkMgr.getNetStats();
+        
+        NetEndpointStats endpoints[UI_STATS_MAX_ROWS];
+        int rows = stats.copyEndpoints(endpoints, UI_STATS_MAX_ROWS);
+        
+        static char text[UI_STATS_MAX_ROWS][UI_STATS_COLS][28];
+        const char* cells[UI_STATS_MAX_ROWS][UI_STATS_COLS];
+        for (int r = 0; r < rows; r++) {
+            const NetEndpointStats& e = endpoints[r];
+            snprintf(text[r][0], sizeof(text[r][0]), "%s", e.endpoint);
+            snprintf(text[r][1], sizeof(text[r][1]), "%lu", e.count);
+            snprintf(text[r][2], sizeof(text[r][2]), "%lu", e.connectMsTotal / e.count);
+            snprintf(text[r][3], sizeof(text[r][3]), "%lu", e.ttfbMsTotal / e.count);
+            snprintf(text[r][4], sizeof(text[r][4]), "%lu", e.transferMsTotal / e.count);
+            snprintf(text[r][5], sizeof(text[r][5]), "%lu", e.parseMsTotal / e.count);
+            snprintf(text[r][6], sizeof(text[r][6]), "%lu/%lu/%lu/%lu/%lu/%lu",
+                     e.histogram[0], e.histogram[1], e.histogram[2],
+                     e.histogram[3], e.histogram[4], e.histogram[5]);
+            for (int c = 0; c < UI_STATS_COLS; c++) cells[r][c] = text[r][c];
+        }
+        
+        char summary[64];
+        snprintf(summary, sizeof(summary), "%lu requests   WiFi %d dBm",
+                 stats.getTotalRequests(), WiFi.RSSI());
+        
+        NetRequestSample last;
+        char lastText[128] = "Last: -";
+        if (stats.copyRecent(&last, 1) == 1) {
+            snprintf(lastText, sizeof(lastText),
+                     "Last: %s %s %d - dns %u conn %u ttfb %u xfer %u parse %u ms, %lu B%s",
+                     last.method, last.endpoint, last.status, last.dnsMs, last.connectMs,
+                     last.ttfbMs, last.transferMs, last.parseMs, last.bytes, last.reused ? ", reused" : "");
+        }
+        
+        uiMgr.showNetworkStats(summary, cells, rows, lastText);
+        shown = true;
+        lastRedraw = millis();
+    }
+    
+    // A resets the counters (e.g. before reproducing a problem on site)
+    if (inputMgr.isBtnAPressed()) {
+        beepClick();
+        networkMgr.getNetStats().reset();
+        shown = false;
+        delay(200);
+    }
+    
+    if (inputMgr.isBtnBPressed()) {
+        beepClick();
+        shown = false;
+        currentState = STATE_DEV_MODE;
+        lastDevMenuIndex = -1;
+        delay(200);
+    }
+}
+
 void handleApiUrlEdit() {
     static bool initialized = false;
     static unsigned long lastBlink = 0;
@@ -948,19 +1033,13 @@ void runWifiTest() {
         
         WiFi.disconnect();
         delay(100);
-        WiFi.begin(WIFI_SSID, WIFI_PASS);
-        
-        int attempts = 0;
-        while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-            uiMgr.update();
-            delay(250);
-            attempts++;
-        }
         
-        if (WiFi.status() == WL_CONNECTED) {
+        if (networkMgr.connect([]() { uiMgr.update(); })) {
             passed = true;
-            snprintf(details, sizeof(details), "Reconnected successfully!\nIP: %s", 
-                     WiFi.localIP().toString().c_str());
+            snprintf(details, sizeof(details), "Reconnected successfully!\nIP: %s\nTook %lu ms (%s)", 
+                     WiFi.localIP().toString().c_str(),
+                     networkMgr.getLastConnectMs(),
+                     networkMgr.wasFastConnect() ? "fast" : "full scan");
         } else {
             passed = false;
             snprintf(details, sizeof(details), "Could not connect to WiFi.\nCheck SSID and password.");
@@ -997,14 +1076,17 @@ void runApiTest() {
         passed = false;
         snprintf(details, sizeof(details), "WiFi not connected.\nConnect to WiFi first.");
     } else {
-        // Try a simple API call
-        std::vector<ExamMetadata> exams = networkMgr.fetchExamList();
-        Serial.printf("[HW_TEST] API returned %d exams\n", exams.size());
+        // Try a simple API call - the first catalog page carries the total
+        CatalogPage page;
+        FetchResult result = networkMgr.fetchCatalogPage(CONTENT_EXAM, "", page);
+        int examCount = page.totalCount >= 0 ? page.totalCount : page.items.size();
+        if (result == FETCH_NOT_MODIFIED) examCount = contentStore.loadCatalog(CONTENT_EXAM).size();
+        Serial.printf("[HW_TEST] API returned %d exams\n", examCount);
         
-        if (exams.size() > 0) {
+        if (examCount > 0) {
             passed = true;
             snprintf(details, sizeof(details), "API: %s\nFound %d exam(s) available.", 
-                     apiUrl.c_str(), exams.size());
+                     apiUrl.c_str(), examCount);
         } else {
             // API might be working but no exams
             passed = true;
@@ -47,7 +47,7 @@ void TranscriptEngine::handleRun(DisplayManager& display, InputManager& input, S
                 if (availableTranscripts.empty()) {
                     uiMgr.showError("No Transcripts Found!");
                     delay(2000);
-                    systemState = 0; // Back to menu
+                    systemState = STATE_MENU;
                 } else {
                     state = TRANS_SELECT;
                     lastSelectedIndex = -1;
@@ -95,7 +95,7 @@ void TranscriptEngine::handleRun(DisplayManager& display, InputManager& input, S
                 // B to go back
                 if (input.isBtnBPressed()) {
                     beepClick();
-                    systemState = 0; // Back to menu
+                    systemState = STATE_MENU;
                     delay(200);
                 }
             }
@@ -142,56 +142,9 @@ void TranscriptEngine::handleRun(DisplayManager& display, InputManager& input, S
                 if (input.isBtnAPressed()) {
                     beepClick();
                     
-                    if (optionIndex == 0) {
-                        // Generate Quiz
-                        state = TRANS_GENERATING;
-                        needsFullRedraw = true;
-                        
-                        // Show generating screen
-                        uiMgr.showLoading("Generating Quiz...");
-                        display.showStatus("AI Generating...");
-                        setLed(false, true); // Green while generating
-                        
-                        Transcript& t = availableTranscripts[selectedTranscriptIndex];
-                        bool success = generateQuizFromTranscript(network, t);
-                        
-                        ledOff();
-                        
-                        if (success) {
-                            state = TRANS_SUCCESS;
-                            beepComplete();
-                            flashLed(false, true, 3, 100, 80);
-                        } else {
-                            state = TRANS_ERROR;
-                            beepError();
-                            flashLed(true, false, 2, 150, 100);
-                        }
-                        needsFullRedraw = true;
-                        
-                    } else if (optionIndex == 1) {
-                        // Generate Flashcards
-                        state = TRANS_GENERATING;
-                        needsFullRedraw = true;
-                        
-                        uiMgr.showLoading("Generating Flashcards...");
+                    if (optionIndex == 0 || optionIndex == 1) {
+                        startGeneration(network, optionIndex == 0);
                         display.showStatus("AI Generating...");
-                        setLed(false, true);
-                        
-                        Transcript& t = availableTranscripts[selectedTranscriptIndex];
-                        bool success = generateFlashcardsFromTranscript(network, t);
-                        
-                        ledOff();
-                        
-                        if (success) {
-                            state = TRANS_SUCCESS;
-                            beepComplete();
-                            flashLed(false, true, 3, 100, 80);
-                        } else {
-                            state = TRANS_ERROR;
-                            beepError();
-                            flashLed(true, false, 2, 150, 100);
-                        }
-                        needsFullRedraw = true;
                         
                     } else if (optionIndex == 2) {
                         // View Transcript
@@ -217,7 +170,7 @@ void TranscriptEngine::handleRun(DisplayManager& display, InputManager& input, S
             break;
 
         case TRANS_GENERATING:
-            // This state is transitory - handled in TRANS_OPTIONS
+            updateGeneration(input, network);
             break;
 
         case TRANS_SUCCESS:
@@ -325,214 +278,291 @@ Transcript TranscriptEngine::fetchTranscript(const String& id) {
 }
 
 // ===================================================================================
-// GENERATION (Calls backend API)
+// GENERATION STATE MACHINE (main loop)
 // ===================================================================================
 
-bool TranscriptEngine::generateQuizFromTranscript(SENetworkManager& network, const Transcript& transcript) {
-    Serial.printf("[TRANSCRIPT] Generating quiz from: %s\n", transcript.title.c_str());
+void TranscriptEngine::startGeneration(SENetworkManager& network, bool isQuiz) {
+    state = TRANS_GENERATING;
+    genPhase = GEN_SUBMIT;
+    genIsQuiz = isQuiz;
+    genStart = millis();
+    lastProgressDraw = genStart;
+    pollIntervalMs = GEN_POLL_MIN_MS;
+    strlcpy(genStatusText, "Sending transcript...", sizeof(genStatusText));
+    needsFullRedraw = true;
     
-    if (!network.isConnected()) {
-        Serial.println("[TRANSCRIPT] Not connected to WiFi");
-        return false;
+    // Progress screen stays animated while the worker talks to the backend
+    uiMgr.showGenerationProgress(isQuiz ? "Generating Quiz" : "Generating Flashcards");
+    uiMgr.updateGenerationProgress(genStatusText, 0, 0);
+    setLed(false, true); // Green while generating
+    
+    // Copy - reset() may clear the list while the request is still queued
+    Transcript transcript = availableTranscripts[selectedTranscriptIndex];
+    generationOk = false;
+    netJob = network.submitJob([this, &network, transcript, isQuiz]() {
+        generationOk = submitGeneration(network, transcript, isQuiz);
+    });
+}
+
+void TranscriptEngine::updateGeneration(InputManager& input, SENetworkManager& network) {
+    unsigned long now = millis();
+    
+    // B cancels in any phase
+    if (input.isBtnBPressed()) {
+        beepClick();
+        cancelGeneration(network);
+        delay(200);
+        return;
     }
     
-    HTTPClient http;
-    WiFiClient client;
-    String url = settingsMgr.getApiBaseUrl() + "/generate/transcript/quiz";
-    
-    Serial.printf("[TRANSCRIPT] POST to: %s\n", url.c_str());
-    
-    if (!http.begin(client, url)) {
-        Serial.println("[TRANSCRIPT] HTTP begin failed");
-        return false;
+    // Elapsed time and estimate once a second; the spinner animates by itself
+    if (now - lastProgressDraw >= 1000) {
+        lastProgressDraw = now;
+        uiMgr.updateGenerationProgress(genStatusText, (now - genStart) / 1000,
+                                       estimateProgress(now - genStart));
     }
     
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(60000); // 60 second timeout for AI generation
+    // Nothing to decide until the request in flight comes back
+    if (netJob && !network.isJobDone(netJob)) return;
+    netJob = 0;
     
-    // Build JSON request
-    DynamicJsonDocument requestDoc(8192);
-    requestDoc["transcript_id"] = transcript.id;
-    requestDoc["transcript_content"] = transcript.content;
-    requestDoc["title"] = transcript.title + " Quiz";
-    requestDoc["model"] = "haiku";
-    requestDoc["num_mcq"] = 5;
-    requestDoc["num_short_answer"] = 2;
-    
-    String requestBody;
-    serializeJson(requestDoc, requestBody);
-    
-    Serial.printf("[TRANSCRIPT] Request size: %d bytes\n", requestBody.length());
-    
-    int httpCode = http.POST(requestBody);
-    Serial.printf("[TRANSCRIPT] Response code: %d\n", httpCode);
-    
-    if (httpCode != 200) {
-        Serial.printf("[TRANSCRIPT] HTTP error: %s\n", http.errorToString(httpCode).c_str());
-        http.end();
-        return false;
+    switch (genPhase) {
+        case GEN_SUBMIT:
+            if (!generationOk) {
+                finishGeneration(false);
+                return;
+            }
+            genPhase = GEN_WAIT;
+            nextPollAt = now;
+            break;
+            
+        case GEN_WAIT:
+            if ((long)(now - nextPollAt) < 0) return;
+            if (now - genStart > GEN_TIMEOUT_MS) {
+                Serial.println("[TRANSCRIPT] Timeout waiting for generation");
+                network.submitJob([this, &network]() { cancelRemoteJob(network); });
+                finishGeneration(false);
+                return;
+            }
+            genPhase = GEN_POLL;
+            pollStartedAt = now;
+            netJob = network.submitJob([this, &network]() {
+                checkGeneration(network, GEN_LONG_POLL_SECS);
+            });
+            break;
+            
+        case GEN_POLL: {
+            if (pollStatus == "completed") {
+                strlcpy(genStatusText, "Saving...", sizeof(genStatusText));
+                uiMgr.updateGenerationProgress(genStatusText, (now - genStart) / 1000, 98);
+                genPhase = GEN_SAVE;
+                generationOk = false;
+                bool isQuiz = genIsQuiz;
+                uint32_t serial = genSerial;
+                netJob = network.submitJob([this, &network, isQuiz, serial]() {
+                    generationOk = saveGeneration(network, isQuiz, serial);
+                });
+                return;
+            }
+            if (pollStatus == "failed") {
+                finishGeneration(false);
+                return;
+            }
+            
+            bool progressed = !pollMessage.isEmpty() && pollMessage != genStatusText;
+            if (progressed) {
+                strlcpy(genStatusText, pollMessage.c_str(), sizeof(genStatusText));
+                lastProgressDraw = 0;  // Redraw on the next pass
+            }
+            
+            // A long-poll that ran its full course already did the waiting;
+            // a quick answer with no news means the server didn't hold it
+            // (or the request failed), so back off before asking again
+            uint32_t pollMs = now - pollStartedAt;
+            uint32_t delayMs;
+            if (progressed || pollMs >= GEN_LONG_POLL_SECS * 1000UL - 500) {
+                pollIntervalMs = GEN_POLL_MIN_MS;
+                delayMs = 0;
+            } else {
+                delayMs = pollIntervalMs;
+                pollIntervalMs = min<uint32_t>(pollIntervalMs * 3 / 2, GEN_POLL_MAX_MS);
+            }
+            genPhase = GEN_WAIT;
+            nextPollAt = now + delayMs;
+            break;
+        }
+            
+        case GEN_SAVE:
+            finishGeneration(generationOk);
+            break;
     }
-    
-    String response = http.getString();
-    http.end();
-    
-    // Parse response to get job_id
-    DynamicJsonDocument responseDoc(1024);
-    DeserializationError error = deserializeJson(responseDoc, response);
-    if (error) {
-        Serial.printf("[TRANSCRIPT] JSON parse error: %s\n", error.c_str());
-        return false;
+}
+
+void TranscriptEngine::finishGeneration(bool ok) {
+    ledOff();
+    
+    if (ok) {
+        state = TRANS_SUCCESS;
+        beepComplete();
+        flashLed(false, true, 3, 100, 80);
+    } else {
+        state = TRANS_ERROR;
+        beepError();
+        flashLed(true, false, 2, 150, 100);
     }
-    
-    String jobId = responseDoc["job_id"].as<String>();
-    Serial.printf("[TRANSCRIPT] Job started: %s\n", jobId.c_str());
-    
-    // Poll for completion
-    return pollGenerationJob(network, jobId, true);
+    needsFullRedraw = true;
 }
 
-bool TranscriptEngine::generateFlashcardsFromTranscript(SENetworkManager& network, const Transcript& transcript) {
-    Serial.printf("[TRANSCRIPT] Generating flashcards from: %s\n", transcript.title.c_str());
+void TranscriptEngine::cancelGeneration(SENetworkManager& network) {
+    Serial.println("[TRANSCRIPT] Generation cancelled");
+    
+    // A request still in flight finishes on the worker and is ignored; the
+    // cancel queues behind it, so it sees whatever job id the submit produced.
+    // A save not yet started sees the new serial and is skipped.
+    genSerial = genSerial + 1;
+    netJob = 0;
+    network.submitJob([this, &network]() { cancelRemoteJob(network); });
+    
+    ledOff();
+    state = TRANS_OPTIONS;
+    needsFullRedraw = true;
+}
+
+int TranscriptEngine::estimateProgress(unsigned long elapsedMs) {
+    // The backend only reports phases, so ease towards 95% around the typical
+    // job length - fast at first, never quite "done" before the result lands
+    return (int)(95ULL * elapsedMs / (elapsedMs + GEN_ESTIMATE_MS / 2));
+}
+
+// ===================================================================================
+// GENERATION REQUESTS (network worker)
+// ===================================================================================
+
+bool TranscriptEngine::submitGeneration(SENetworkManager& network, const Transcript& transcript, bool isQuiz) {
+    Serial.printf("[TRANSCRIPT] Generating %s from: %s\n", isQuiz ? "quiz" : "flashcards",
+                  transcript.title.c_str());
+    activeJobId = "";
     
     if (!network.isConnected()) {
         Serial.println("[TRANSCRIPT] Not connected to WiFi");
         return false;
     }
     
-    HTTPClient http;
-    WiFiClient client;
-    String url = settingsMgr.getApiBaseUrl() + "/generate/transcript/flashcards";
-    
-    Serial.printf("[TRANSCRIPT] POST to: %s\n", url.c_str());
-    
-    if (!http.begin(client, url)) {
-        Serial.println("[TRANSCRIPT] HTTP begin failed");
-        return false;
-    }
-    
-    http.addHeader("Content-Type", "application/json");
-    http.setTimeout(60000); // 60 second timeout for AI generation
+    String path = isQuiz ? "/generate/transcript/quiz" : "/generate/transcript/flashcards";
     
     // Build JSON request
     DynamicJsonDocument requestDoc(8192);
     requestDoc["transcript_id"] = transcript.id;
     requestDoc["transcript_content"] = transcript.content;
-    requestDoc["title"] = transcript.title + " Flashcards";
     requestDoc["model"] = "haiku";
-    requestDoc["num_flashcards"] = 10;
+    if (isQuiz) {
+        requestDoc["title"] = transcript.title + " Quiz";
+        requestDoc["num_mcq"] = 5;
+        requestDoc["num_short_answer"] = 2;
+    } else {
+        requestDoc["title"] = transcript.title + " Flashcards";
+        requestDoc["num_flashcards"] = 10;
+    }
     
     String requestBody;
     serializeJson(requestDoc, requestBody);
+    Serial.printf("[TRANSCRIPT] POST %s (%d bytes)\n", path.c_str(), requestBody.length());
     
-    Serial.printf("[TRANSCRIPT] Request size: %d bytes\n", requestBody.length());
-    
-    int httpCode = http.POST(requestBody);
-    Serial.printf("[TRANSCRIPT] Response code: %d\n", httpCode);
-    
+    // The backend only queues the job here, so a normal timeout is enough
+    String response;
+    int httpCode = network.post(path, requestBody, response, 15000);
     if (httpCode != 200) {
-        Serial.printf("[TRANSCRIPT] HTTP error: %s\n", http.errorToString(httpCode).c_str());
-        http.end();
+        Serial.printf("[TRANSCRIPT] HTTP error: %s\n", HTTPClient::errorToString(httpCode).c_str());
         return false;
     }
     
-    String response = http.getString();
-    http.end();
-    
     // Parse response to get job_id
-    DynamicJsonDocument responseDoc(1024);
-    DeserializationError error = deserializeJson(responseDoc, response);
+    StaticJsonDocument<32> idFilter;
+    idFilter["job_id"] = true;
+    StaticJsonDocument<192> responseDoc;
+    DeserializationError error = deserializeJson(responseDoc, response, DeserializationOption::Filter(idFilter));
     if (error) {
         Serial.printf("[TRANSCRIPT] JSON parse error: %s\n", error.c_str());
         return false;
     }
     
-    String jobId = responseDoc["job_id"].as<String>();
-    Serial.printf("[TRANSCRIPT] Job started: %s\n", jobId.c_str());
-    
-    // Poll for completion
-    return pollGenerationJob(network, jobId, false);
+    activeJobId = responseDoc["job_id"].as<String>();
+    Serial.printf("[TRANSCRIPT] Job started: %s\n", activeJobId.c_str());
+    return !activeJobId.isEmpty();
 }
 
-bool TranscriptEngine::pollGenerationJob(SENetworkManager& network, const String& jobId, bool isQuiz) {
-    Serial.printf("[TRANSCRIPT] Polling job: %s\n", jobId.c_str());
+void TranscriptEngine::checkGeneration(SENetworkManager& network, int waitSecs) {
+    pollStatus = "";
+    pollMessage = "";
+    if (activeJobId.isEmpty()) {
+        pollStatus = "failed";
+        return;
+    }
     
-    HTTPClient http;
-    WiFiClient client;
-    String statusUrl = settingsMgr.getApiBaseUrl() + "/generate/status/" + jobId;
+    // Long-poll: the backend answers early when the job moves on, otherwise
+    // after waitSecs. Every poll rides the same keep-alive socket.
+    String statusPath = "/generate/status/" + activeJobId + "?wait=" + waitSecs;
+    String response;
+    int httpCode = network.get(statusPath, response, (waitSecs + 5) * 1000UL);
+    if (httpCode != 200) {
+        Serial.printf("[TRANSCRIPT] Status poll failed: %d\n", httpCode);
+        return;
+    }
     
-    int maxAttempts = 60;  // Max 60 attempts (about 60 seconds)
+    // The result payload can be large - only status and progress matter here
+    StaticJsonDocument<64> filter;
+    filter["status"] = true;
+    filter["error"] = true;
+    filter["progress_message"] = true;
+    DynamicJsonDocument doc(1024);
+    if (deserializeJson(doc, response, DeserializationOption::Filter(filter))) return;
     
-    for (int attempt = 0; attempt < maxAttempts; attempt++) {
-        if (!http.begin(client, statusUrl)) {
-            Serial.println("[TRANSCRIPT] HTTP begin failed");
-            delay(1000);
-            continue;
-        }
-        
-        http.setTimeout(10000);
-        int httpCode = http.GET();
-        
-        if (httpCode != 200) {
-            http.end();
-            delay(1000);
-            continue;
-        }
-        
-        String response = http.getString();
-        http.end();
-        
-        DynamicJsonDocument doc(4096);
-        DeserializationError error = deserializeJson(doc, response);
-        if (error) {
-            delay(1000);
-            continue;
-        }
-        
-        String status = doc["status"].as<String>();
-        Serial.printf("[TRANSCRIPT] Job status: %s (attempt %d)\n", status.c_str(), attempt + 1);
-        
-        if (status == "completed") {
-            // Job completed successfully - save to database
-            String saveUrl = settingsMgr.getApiBaseUrl() + "/generate/save/" + jobId;
-            
-            HTTPClient saveHttp;
-            if (saveHttp.begin(client, saveUrl)) {
-                saveHttp.setTimeout(10000);
-                int saveCode = saveHttp.POST("");
-                
-                if (saveCode == 200) {
-                    String saveResponse = saveHttp.getString();
-                    DynamicJsonDocument saveDoc(512);
-                    deserializeJson(saveDoc, saveResponse);
-                    
-                    String generatedId = saveDoc["id"].as<String>();
-                    
-                    if (isQuiz) {
-                        generatedQuizId = generatedId;
-                        generatedDeckId = "";
-                    } else {
-                        generatedDeckId = generatedId;
-                        generatedQuizId = "";
-                    }
-                    
-                    Serial.printf("[TRANSCRIPT] Saved with ID: %s\n", generatedId.c_str());
-                    saveHttp.end();
-                    return true;
-                }
-                saveHttp.end();
-            }
-            return false;
-        }
-        else if (status == "failed") {
-            String errorMsg = doc["error"].as<String>();
-            Serial.printf("[TRANSCRIPT] Generation failed: %s\n", errorMsg.c_str());
-            return false;
-        }
-        
-        // Still processing, wait and try again
-        delay(1000);
+    pollStatus = doc["status"].as<String>();
+    pollMessage = doc["progress_message"] | "";
+    Serial.printf("[TRANSCRIPT] Job status: %s (%s)\n", pollStatus.c_str(), pollMessage.c_str());
+    
+    if (pollStatus == "failed") {
+        Serial.printf("[TRANSCRIPT] Generation failed: %s\n", doc["error"] | "unknown");
+    }
+}
+
+bool TranscriptEngine::saveGeneration(SENetworkManager& network, bool isQuiz, uint32_t serial) {
+    // Cancelled while queued - leave the job for cancelRemoteJob to discard
+    if (serial != genSerial) {
+        Serial.println("[TRANSCRIPT] Save skipped - generation was cancelled");
+        return false;
+    }
+    
+    String saveResponse;
+    int saveCode = network.post("/generate/save/" + activeJobId, "", saveResponse, 10000);
+    activeJobId = "";
+    if (saveCode != 200) return false;
+    
+    StaticJsonDocument<32> idFilter;
+    idFilter["id"] = true;
+    StaticJsonDocument<192> saveDoc;
+    deserializeJson(saveDoc, saveResponse, DeserializationOption::Filter(idFilter));
+    String generatedId = saveDoc["id"].as<String>();
+    
+    if (isQuiz) {
+        generatedQuizId = generatedId;
+        generatedDeckId = "";
+    } else {
+        generatedDeckId = generatedId;
+        generatedQuizId = "";
     }
     
-    Serial.println("[TRANSCRIPT] Timeout waiting for generation");
-    return false;
+    Serial.printf("[TRANSCRIPT] Saved with ID: %s\n", generatedId.c_str());
+    network.printSessionStats();
+    return true;
+}
+
+void TranscriptEngine::cancelRemoteJob(SENetworkManager& network) {
+    if (activeJobId.isEmpty()) return;
+    
+    // Fire and forget - a lost cancel only means the backend finishes a job nobody reads
+    String response;
+    int httpCode = network.post("/generate/cancel/" + activeJobId, "", response, 5000);
+    Serial.printf("[TRANSCRIPT] Cancel %s: %d\n", activeJobId.c_str(), httpCode);
+    activeJobId = "";
 }
@@ -40,6 +40,20 @@ enum TranscriptState {
     TRANS_ERROR
 };
 
+// TRANS_GENERATING sub-states - every HTTP call is one network worker job
+enum GenerationPhase {
+    GEN_SUBMIT,   // POST /generate/transcript/* in flight
+    GEN_WAIT,     // Waiting out the poll interval
+    GEN_POLL,     // GET /generate/status/{job_id} in flight
+    GEN_SAVE      // POST /generate/save/{job_id} in flight
+};
+
+#define GEN_POLL_MIN_MS      500      // First polls come quickly...
+#define GEN_POLL_MAX_MS      5000     // ...then back off to this
+#define GEN_LONG_POLL_SECS   10       // ?wait= - server holds the request until progress changes
+#define GEN_TIMEOUT_MS       180000   // Give up (and cancel server-side) after 3 minutes
+#define GEN_ESTIMATE_MS      30000    // Typical job length, drives the progress estimate
+
 class TranscriptEngine {
 public:
     void reset();
@@ -64,6 +78,32 @@ private:
     
     bool needsFullRedraw = true;
     
+    // Generation job on the network worker
+    NetJobId netJob = 0;
+    volatile bool generationOk = false;
+    
+    // TRANS_GENERATING progress (main loop only)
+    GenerationPhase genPhase = GEN_SUBMIT;
+    bool genIsQuiz = false;
+    unsigned long genStart = 0;
+    unsigned long nextPollAt = 0;
+    unsigned long pollStartedAt = 0;
+    unsigned long lastProgressDraw = 0;
+    uint32_t pollIntervalMs = GEN_POLL_MIN_MS;
+    char genStatusText[64];
+    
+    // Written by worker jobs, read once the job is done
+    String pollStatus;     // "pending" / "processing" / "completed" / "failed", "" on error
+    String pollMessage;    // Backend progress_message
+    
+    // Backend job id - only touched on the network worker, so a cancel queued
+    // behind a still-running submit sees the id that submit produced
+    String activeJobId;
+    
+    // Bumped by every cancel. A save job captures it when submitted and
+    // commits nothing if a cancel came in while it was queued.
+    volatile uint32_t genSerial = 0;
+    
     // Generated content IDs (for handoff)
     String generatedQuizId;
     String generatedDeckId;
@@ -72,10 +112,18 @@ private:
     std::vector<Transcript> fetchTranscriptList();
     Transcript fetchTranscript(const String& id);
     
-    // Generation (calls backend API)
-    bool generateQuizFromTranscript(SENetworkManager& network, const Transcript& transcript);
-    bool generateFlashcardsFromTranscript(SENetworkManager& network, const Transcript& transcript);
-    bool pollGenerationJob(SENetworkManager& network, const String& jobId, bool isQuiz);
+    // Generation state machine (main loop)
+    void startGeneration(SENetworkManager& network, bool isQuiz);
+    void updateGeneration(InputManager& input, SENetworkManager& network);
+    void finishGeneration(bool ok);
+    void cancelGeneration(SENetworkManager& network);
+    int estimateProgress(unsigned long elapsedMs);
+    
+    // Generation requests (run on the network worker)
+    bool submitGeneration(SENetworkManager& network, const Transcript& transcript, bool isQuiz);
+    void checkGeneration(SENetworkManager& network, int waitSecs);
+    bool saveGeneration(SENetworkManager& network, bool isQuiz, uint32_t serial);
+    void cancelRemoteJob(SENetworkManager& network);
 };
 
 // Global instance
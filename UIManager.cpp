@@ -6,15 +6,20 @@
 
 #include "UIManager.h"
 #include "UITheme.h"
+#include "ContentPartition.h"
+#include "SettingsManager.h"
 
 // Static member initialization for LVGL 9.x
 lv_display_t* UIManager::display = nullptr;
 uint8_t* UIManager::draw_buf = nullptr;
+uint8_t* UIManager::draw_buf2 = nullptr;
 
 // Singleton instance
 UIManager uiMgr;
 
-// Static flush callback for LVGL 9.x
+// Static flush callback for LVGL 9.x. With DMA the transfer is only queued
+// here; LVGL goes on rendering the next stripe into the other buffer and
+// calls flush_wait() once it needs this one back.
 void UIManager::disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
@@ -24,15 +29,74 @@ void UIManager::disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *p
         lv_display_flush_ready(disp);
         return;
     }
+    mgr->flushStats.flushes++;
+    mgr->flushStats.pixels += w * h;
+    
+#ifndef UI_NATIVE_SWAP
+    lv_draw_sw_rgb565_swap(px_map, w * h);
+#endif
+    
+    uint32_t t0 = micros();
+    if (mgr->dmaEnabled) {
+        mgr->tft.startWrite();
+        mgr->tft.pushImageDMA(area->x1, area->y1, w, h, (uint16_t*)px_map);
+        mgr->flushInFlight = true;
+        mgr->frameStats.addFlush(micros() - t0);
+        return;
+    }
     
     mgr->tft.startWrite();
     mgr->tft.setAddrWindow(area->x1, area->y1, w, h);
-    mgr->tft.pushColors((uint16_t*)px_map, w * h, true);
+    mgr->tft.pushColors((uint16_t*)px_map, w * h, false);
     mgr->tft.endWrite();
+    mgr->frameStats.addFlush(micros() - t0);
     
     lv_display_flush_ready(disp);
 }
 
+void UIManager::flush_wait(lv_display_t *disp) {
+    UIManager* mgr = (UIManager*)lv_display_get_user_data(disp);
+    if (mgr) mgr->finishFlush();
+    lv_display_flush_ready(disp);
+}
+
+// Blocks until the queued transfer is out and releases the bus
+void UIManager::finishFlush() {
+    if (!flushInFlight) return;
+    uint32_t t0 = micros();
+    tft.dmaWait();
+    tft.endWrite();
+    flushInFlight = false;
+    uint32_t waited = micros() - t0;
+    flushStats.waitUs += waited;
+    frameStats.addFlush(waited);
+}
+
+// Brackets each frame that has something to draw (idle refreshes send neither)
+void UIManager::render_event(lv_event_t* e) {
+    UIManager* mgr = (UIManager*)lv_event_get_user_data(e);
+    if (lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        mgr->frameStats.beginFrame();
+    } else {
+        mgr->frameStats.endFrame();
+    }
+}
+
+TFT_eSPI& UIManager::getTft() {
+    finishFlush();
+    return tft;
+}
+
+void UIManager::printFlushStats() {
+    uint32_t ms = millis() - flushStats.sinceMs;
+    if (ms == 0) ms = 1;
+    Serial.printf("[UI] Flush: %lu flushes, %lu px in %lu ms (%lu KB/s), %lu ms waiting on DMA\n",
+                  flushStats.flushes, flushStats.pixels, ms, flushStats.pixels * 2 / ms,
+                  flushStats.waitUs / 1000);
+    flushStats = FlushStats();
+    flushStats.sinceMs = millis();
+}
+
 void UIManager::begin() {
     Serial.println("[UI] Initializing LVGL 9.x...");
     
@@ -40,18 +104,22 @@ void UIManager::begin() {
     tft.init(); // Use init() instead of begin() for some drivers
     tft.setRotation(1);  // Landscape
     tft.fillScreen(TFT_BLACK);
-    Serial.println("[UI] TFT initialized");
+    tft.setSwapBytes(false);  // LVGL hands over panel byte order already
+    dmaEnabled = tft.initDMA();
+    Serial.printf("[UI] TFT initialized (%s)\n", dmaEnabled ? "DMA" : "blocking SPI");
     
     // Initialize LVGL
     lv_init();
     Serial.println("[UI] lv_init() done");
     
-    // Create display buffer (LVGL 9.x style) - reduced size for memory
-    uint32_t buf_size = SCREEN_WIDTH * 20 * sizeof(lv_color_t);
+    // Two stripe buffers (LVGL 9.x style) - reduced size for memory. RGB565 is
+    // 2 bytes a pixel; sizeof(lv_color_t) is the 3-byte RGB888 struct in 9.x.
+    uint32_t buf_size = SCREEN_WIDTH * UI_DRAW_BUF_LINES * 2;
     draw_buf = (uint8_t*)heap_caps_malloc(buf_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
     if (!draw_buf) {
         Serial.println("[UI] DMA alloc failed, using regular malloc");
         draw_buf = (uint8_t*)malloc(buf_size);
+        dmaEnabled = false;  // DMA cannot read from it
     }
     
     if (!draw_buf) {
@@ -59,15 +127,28 @@ void UIManager::begin() {
         return;
     }
     
+    // Without the second buffer LVGL waits for each transfer before
+    // rendering again - still correct, just not overlapped
+    if (dmaEnabled) draw_buf2 = (uint8_t*)heap_caps_malloc(buf_size, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (dmaEnabled && !draw_buf2) Serial.println("[UI] Second draw buffer unavailable - single buffered");
+    
     // Create display (LVGL 9.x API)
     display = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
     if (!display) {
         Serial.println("[UI] ERROR: Display creation failed!");
         return;
     }
+#ifdef UI_NATIVE_SWAP
+    lv_display_set_color_format(display, LV_COLOR_FORMAT_RGB565_SWAPPED);
+#endif
     lv_display_set_flush_cb(display, disp_flush);
-    lv_display_set_buffers(display, draw_buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    if (dmaEnabled) lv_display_set_flush_wait_cb(display, flush_wait);
+    lv_display_set_buffers(display, draw_buf, draw_buf2, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
     lv_display_set_user_data(display, this);
+    lv_display_add_event_cb(display, render_event, LV_EVENT_RENDER_START, this);
+    lv_display_add_event_cb(display, render_event, LV_EVENT_RENDER_READY, this);
+    flushStats.sinceMs = millis();
+    frameStats.reset();
     
     // Initialize theme
     UITheme::init();
@@ -77,16 +158,67 @@ void UIManager::begin() {
 
 void UIManager::update() {
     lv_timer_handler();
+    
+    bool showFps = settingsMgr.getShowFPS();
+    updateFpsOverlay(showFps);
+    
+    // Flush throughput and frame timing report while Show FPS is on
+    if (showFps && millis() - lastFlushReport >= 5000) {
+        printFlushStats();
+        frameStats.print();
+        lastFlushReport = millis();
+    }
+}
+
+// Always-on-top frame timing, retexted once a second. It sits on the top
+// layer, so screen changes never cover or delete it.
+void UIManager::updateFpsOverlay(bool enabled) {
+    if (!enabled) {
+        if (fpsOverlay) {
+            lv_obj_delete(fpsOverlay);
+            fpsOverlay = nullptr;
+        }
+        return;
+    }
+    
+    if (!fpsOverlay) {
+        fpsOverlay = lv_label_create(lv_layer_top());
+        lv_obj_set_style_text_font(fpsOverlay, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_text_color(fpsOverlay, lv_color_white(), 0);
+        lv_obj_set_style_bg_color(fpsOverlay, lv_color_hex(0x000000), 0);
+        lv_obj_set_style_bg_opa(fpsOverlay, LV_OPA_60, 0);
+        lv_obj_set_style_pad_all(fpsOverlay, 4, 0);
+        lv_obj_set_style_radius(fpsOverlay, 4, 0);
+        lv_obj_remove_flag(fpsOverlay, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_align(fpsOverlay, LV_ALIGN_TOP_RIGHT, -4, 4);
+        lastOverlayUpdate = 0;
+    }
+    if (lastOverlayUpdate != 0 && millis() - lastOverlayUpdate < 1000) return;
+    lastOverlayUpdate = millis();
+    
+    // Last frame's draw and flush, loop period now and its p99 over the window
+    FrameStatSummary loop = frameStats.loop.summarize();
+    char text[96];
+    snprintf(text, sizeof(text), "%lu fps  draw %lu.%lu  flush %lu.%lu ms\nloop %lu.%lu ms  p99 %lu.%lu ms",
+             frameStats.getFps(),
+             frameStats.draw.lastUs() / 1000, (frameStats.draw.lastUs() / 100) % 10,
+             frameStats.flush.lastUs() / 1000, (frameStats.flush.lastUs() / 100) % 10,
+             frameStats.loop.lastUs() / 1000, (frameStats.loop.lastUs() / 100) % 10,
+             loop.p99Us / 1000, (loop.p99Us / 100) % 10);
+    lv_label_set_text(fpsOverlay, text);
 }
 
 // Helper to load screen and force immediate refresh
 void UIManager::loadScreen(lv_obj_t* scr) {
-    // Delete old screen if exists
+    // Delete old screen if exists (retained screens are kept for next time)
     if (currentScreen != NULL && currentScreen != scr) {
         lv_obj_t* oldScreen = currentScreen;
         currentScreen = scr;
         lv_screen_load(scr);
-        lv_obj_delete(oldScreen);
+        if (oldScreen == genScreen) genScreen = nullptr;  // Its labels die with it
+        if (oldScreen == timerScreen.screen) timerScreen.screen = nullptr;
+        if (oldScreen == answerSheet.screen) answerSheet.screen = nullptr;
+        if (!isRetained(oldScreen)) lv_obj_delete(oldScreen);
     } else {
         currentScreen = scr;
         lv_screen_load(scr);
@@ -127,6 +259,16 @@ lv_obj_t* UIManager::createHeader(lv_obj_t* parent, const char* title, bool show
     return header;
 }
 
+// Text that lives in the mapped content partition stays put for as long as the
+// screen does, so the label can point at it instead of keeping its own copy
+void UIManager::setLabelText(lv_obj_t* label, const char* text) {
+    if (contentPartition.contains(text)) {
+        lv_label_set_text_static(label, text);
+    } else {
+        lv_label_set_text(label, text);
+    }
+}
+
 lv_obj_t* UIManager::createCard(lv_obj_t* parent, int x, int y, int w, int h) {
     lv_obj_t* card = lv_obj_create(parent);
     lv_obj_set_size(card, w, h);
@@ -161,7 +303,7 @@ lv_obj_t* UIManager::createAnswerButton(lv_obj_t* parent, int index, const char*
     
     // Answer text
     lv_obj_t* textLabel = lv_label_create(btn);
-    lv_label_set_text(textLabel, text);
+    setLabelText(textLabel, text);
     lv_obj_set_style_text_font(textLabel, &lv_font_montserrat_16, 0);
     lv_label_set_long_mode(textLabel, LV_LABEL_LONG_SCROLL_CIRCULAR);
     lv_obj_set_width(textLabel, SCREEN_WIDTH - 120);
@@ -198,74 +340,287 @@ void UIManager::setAnswerButtonState(lv_obj_t* btn, int index, bool isPending, b
 }
 
 // ===================================================================================
-// SCREEN IMPLEMENTATIONS
+// VIRTUAL LISTS
 // ===================================================================================
+// Rows carry the selected style under LV_STATE_CHECKED, so moving the
+// selection is a state flip on two rows instead of a rebuilt screen. Rows are
+// never bound to an item: each one shows whatever item its slot holds now.
 
-void UIManager::showMainMenu(int selectedIndex, int itemCount, const char** items) {
-    lv_obj_t* scr = createScreen();
-    
-    createHeader(scr, "Study Engine", false);
+static const char* menuIcon(int index) {
+    switch (index) {
+        case 0:  return LV_SYMBOL_EDIT;    // Scanatron
+        case 1:  return LV_SYMBOL_CHARGE;  // Study Timer
+        case 2:  return LV_SYMBOL_FILE;    // Flashcards
+        default: return LV_SYMBOL_BULLET;  // Quiz
+    }
+}
+
+// Sets a label only if its text differs - an unchanged row invalidates nothing
+static void retext(lv_obj_t* label, const char* text) {
+    if (strcmp(lv_label_get_text(label), text) != 0) lv_label_set_text(label, text);
+}
+
+lv_obj_t* UIManager::createMenuRow(lv_obj_t* list) {
+    lv_obj_t* item = lv_obj_create(list);
+    lv_obj_set_size(item, SCREEN_WIDTH - 50, 70); // Slightly taller
+    lv_obj_add_style(item, &UITheme::style_list_item, 0);
+    lv_obj_add_style(item, &UITheme::style_list_item_selected, LV_STATE_CHECKED);
+    lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+    
+    // Icon based on menu item
+    lv_obj_t* icon = lv_label_create(item);
+    lv_label_set_text(icon, "");
+    lv_obj_set_style_text_font(icon, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_color(icon, UI_COLOR_TEXT_SECONDARY, 0);
+    lv_obj_align(icon, LV_ALIGN_LEFT_MID, 10, 0);
+    
+    // Label
+    lv_obj_t* label = lv_label_create(item);
+    lv_label_set_text(label, "");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
+    lv_obj_align(label, LV_ALIGN_LEFT_MID, 50, 0);
+    
+    // Arrow
+    lv_obj_t* arrow = lv_label_create(item);
+    lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
+    lv_obj_set_style_text_color(arrow, UI_COLOR_TEXT_MUTED, 0);
+    lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -10, 0);
+    return item;
+}
+
+lv_obj_t* UIManager::createListRow(lv_obj_t* list) {
+    lv_obj_t* item = lv_obj_create(list);
+    lv_obj_set_size(item, SCREEN_WIDTH - 50, 65);
+    lv_obj_add_style(item, &UITheme::style_list_item, 0);
+    lv_obj_add_style(item, &UITheme::style_list_item_selected, LV_STATE_CHECKED);
+    lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+    
+    // Exam icon
+    lv_obj_t* icon = lv_label_create(item);
+    lv_label_set_text(icon, LV_SYMBOL_FILE);
+    lv_obj_set_style_text_font(icon, &lv_font_montserrat_22, 0);
+    lv_obj_set_style_text_color(icon, UI_COLOR_SECONDARY, 0);
+    lv_obj_align(icon, LV_ALIGN_LEFT_MID, 5, 0);
+    
+    // Exam name
+    lv_obj_t* name = lv_label_create(item);
+    lv_label_set_text(name, "");
+    lv_obj_set_style_text_font(name, &lv_font_montserrat_18, 0);
+    lv_label_set_long_mode(name, LV_LABEL_LONG_SCROLL_CIRCULAR);
+    lv_obj_set_width(name, SCREEN_WIDTH - 150);
+    lv_obj_align(name, LV_ALIGN_LEFT_MID, 45, 0);
+    
+    // Arrow
+    lv_obj_t* arrow = lv_label_create(item);
+    lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
+    lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -5, 0);
+    return item;
+}
+
+lv_obj_t* UIManager::createTranscriptRow(lv_obj_t* list) {
+    lv_obj_t* item = lv_obj_create(list);
+    lv_obj_set_size(item, SCREEN_WIDTH - 45, 52);
+    lv_obj_add_style(item, &UITheme::style_list_item, 0);
+    lv_obj_add_style(item, &UITheme::style_list_item_selected, LV_STATE_CHECKED);
+    lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+    
+    // Microphone icon
+    lv_obj_t* icon = lv_label_create(item);
+    lv_label_set_text(icon, LV_SYMBOL_AUDIO);
+    lv_obj_set_style_text_font(icon, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_color(icon, UI_COLOR_TEXT_SECONDARY, 0);
+    lv_obj_align(icon, LV_ALIGN_LEFT_MID, 8, 0);
     
-    // Scrollable list container
-    lv_obj_t* list = lv_obj_create(scr);
-    lv_obj_set_size(list, SCREEN_WIDTH, SCREEN_HEIGHT - 50);
-    lv_obj_set_pos(list, 0, 50);
-    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_all(list, 15, 0);
-    lv_obj_set_style_pad_row(list, 15, 0);
-    lv_obj_set_style_bg_opa(list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(list, 0, 0);
+    // Title
+    lv_obj_t* titleLbl = lv_label_create(item);
+    lv_label_set_text(titleLbl, "");
+    lv_obj_set_style_text_font(titleLbl, &lv_font_montserrat_16, 0);
+    lv_obj_set_style_text_color(titleLbl, UI_COLOR_TEXT_PRIMARY, 0);
+    lv_obj_set_width(titleLbl, SCREEN_WIDTH - 120);
+    lv_label_set_long_mode(titleLbl, LV_LABEL_LONG_DOT);
+    lv_obj_align(titleLbl, LV_ALIGN_LEFT_MID, 40, -8);
+    
+    // Date
+    lv_obj_t* dateLbl = lv_label_create(item);
+    lv_label_set_text(dateLbl, "");
+    lv_obj_set_style_text_font(dateLbl, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(dateLbl, UI_COLOR_TEXT_MUTED, 0);
+    lv_obj_align(dateLbl, LV_ALIGN_LEFT_MID, 40, 10);
+    
+    // Arrow
+    lv_obj_t* arrow = lv_label_create(item);
+    lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
+    lv_obj_set_style_text_color(arrow, UI_COLOR_TEXT_MUTED, 0);
+    lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -10, 0);
+    return item;
+}
+
+// Fills the (non-scrolling) list container with as many rows as fit it, plus
+// the position thumb at its right edge
+template <typename CreateRow>
+void UIManager::createRows(VirtualList& vl, int rowHeight, CreateRow createRow) {
+    lv_obj_remove_flag(vl.list, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_update_layout(vl.list);
+    int gap = lv_obj_get_style_pad_row(vl.list, LV_PART_MAIN);
+    int slots = max(1, (int)(lv_obj_get_content_height(vl.list) + gap) / (rowHeight + gap));
+    
+    for (int i = 0; i < slots; i++) {
+        lv_obj_t* row = createRow(vl.list);
+        lv_obj_add_flag(row, LV_OBJ_FLAG_HIDDEN);
+        vl.rows.push_back(row);
+    }
     
-    // Menu items
-    for (int i = 0; i < itemCount; i++) {
-        lv_obj_t* item = lv_obj_create(list);
-        lv_obj_set_size(item, SCREEN_WIDTH - 50, 70); // Slightly taller
+    vl.thumb = lv_obj_create(vl.list);
+    lv_obj_add_flag(vl.thumb, LV_OBJ_FLAG_IGNORE_LAYOUT);
+    lv_obj_add_flag(vl.thumb, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(vl.thumb, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_width(vl.thumb, 4);
+    lv_obj_set_style_radius(vl.thumb, 2, 0);
+    lv_obj_set_style_border_width(vl.thumb, 0, 0);
+    lv_obj_set_style_bg_color(vl.thumb, UI_COLOR_TEXT_MUTED, 0);
+}
+
+static void setVisible(lv_obj_t* obj, bool visible) {
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) != visible) return;
+    if (visible) lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+// Moves the window just far enough to keep `selected` in view, then rebinds
+// each row to the item in its slot. bindRow(row, item) retexts the row; rows
+// past the last item are hidden.
+template <typename BindRow>
+void UIManager::syncList(VirtualList& vl, int count, int selected, lv_color_t iconColor,
+                         lv_color_t iconSelectedColor, BindRow bindRow) {
+    int slots = vl.rows.size();
+    if (selected >= count) selected = -1;
+    if (selected >= 0 && selected < vl.first) vl.first = selected;
+    if (selected >= vl.first + slots) vl.first = selected - slots + 1;
+    vl.first = constrain(vl.first, 0, max(0, count - slots));
+    
+    for (int r = 0; r < slots; r++) {
+        lv_obj_t* row = vl.rows[r];
+        int item = vl.first + r;
+        setVisible(row, item < count);
+        if (item >= count) continue;
         
-        if (i == selectedIndex) {
-            lv_obj_add_style(item, &UITheme::style_list_item_selected, 0);
-            lv_obj_scroll_to_view(item, LV_ANIM_OFF);
-        } else {
-            lv_obj_add_style(item, &UITheme::style_list_item, 0);
+        bindRow(row, item);
+        bool checked = item == selected;
+        if (lv_obj_has_state(row, LV_STATE_CHECKED) != checked) {
+            if (checked) lv_obj_add_state(row, LV_STATE_CHECKED);
+            else lv_obj_remove_state(row, LV_STATE_CHECKED);
+            lv_obj_set_style_text_color(lv_obj_get_child(row, 0), checked ? iconSelectedColor : iconColor, 0);
         }
-        lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+    }
+    vl.selected = selected;
+    
+    // Thumb length is the visible share of the list, its offset the window's
+    bool overflow = count > slots;
+    setVisible(vl.thumb, overflow);
+    if (overflow) {
+        int track = lv_obj_get_content_height(vl.list);
+        int len = max(12, track * slots / count);
+        lv_obj_set_height(vl.thumb, len);
+        lv_obj_align(vl.thumb, LV_ALIGN_TOP_RIGHT, 0, (track - len) * vl.first / (count - slots));
+    }
+}
+
+// Loads a retained screen, or just flushes what changed if it is up already
+void UIManager::showRetained(lv_obj_t* scr) {
+    if (currentScreen != scr) {
+        loadScreen(scr);
+    } else {
+        lv_refr_now(display);
+    }
+}
+
+// Build vs. update cost of a show call, with Serial Debug on
+void UIManager::logShowTime(const char* what, bool built, uint32_t startUs) {
+    if (!settingsMgr.getSerialDebug()) return;
+    Serial.printf("[UI] %s %s in %lu us\n", what, built ? "built" : "updated", micros() - startUs);
+}
+
+// Everything a timer screen is built from except the time itself. A tick
+// that leaves the key unchanged updates the screen in place.
+uint32_t UIManager::timerKey(TimerView view, uint8_t state, uint8_t session, uint8_t total) {
+    return ((uint32_t)view << 24) | ((uint32_t)state << 16) | ((uint32_t)session << 8) | total;
+}
+
+bool UIManager::isTimerScreenFor(uint32_t key) {
+    return timerScreen.screen != nullptr && timerScreen.screen == currentScreen && timerScreen.key == key;
+}
+
+// Retexts the digits only when the shown second changed. The label has a
+// fixed width, so a new time invalidates the same small rectangle and never
+// re-lays out the card.
+void UIManager::setTimerText(lv_obj_t* label, unsigned long secs) {
+    char timeStr[20];
+    int hours = secs / 3600;
+    int minutes = (secs % 3600) / 60;
+    int seconds = secs % 60;
+    if (hours > 0) {
+        snprintf(timeStr, sizeof(timeStr), "%d:%02d:%02d", hours, minutes, seconds);
+    } else {
+        snprintf(timeStr, sizeof(timeStr), "%02d:%02d", minutes, seconds);
+    }
+    if (strcmp(lv_label_get_text(label), timeStr) != 0) lv_label_set_text(label, timeStr);
+}
+
+// Loads a freshly built timer screen, or flushes the dirty digits and arc of
+// the one already up (scr == nullptr)
+void UIManager::showTimerScreen(lv_obj_t* scr, uint32_t key) {
+    if (scr == nullptr) {
+        lv_refr_now(display);
+        return;
+    }
+    loadScreen(scr);
+    timerScreen.screen = scr;
+    timerScreen.key = key;
+}
+
+// ===================================================================================
+// SCREEN IMPLEMENTATIONS
+// ===================================================================================
+
+void UIManager::showMainMenu(int selectedIndex, int itemCount, const char** items) {
+    uint32_t t0 = micros();
+    bool built = false;
+    VirtualList& ls = menuScreen;
+    
+    if (!ls.screen) {
+        ls.screen = createScreen();
+        lv_obj_t* header = createHeader(ls.screen, "Study Engine", false);
+        ls.title = lv_obj_get_child(header, 0);
         
-        // Icon based on menu item
-        lv_obj_t* icon = lv_label_create(item);
-        if (i == 0) {
-            lv_label_set_text(icon, LV_SYMBOL_EDIT);  // Scanatron
-        } else if (i == 1) {
-            lv_label_set_text(icon, LV_SYMBOL_CHARGE);  // Study Timer
-        } else if (i == 2) {
-            lv_label_set_text(icon, LV_SYMBOL_FILE);  // Flashcards
-        } else {
-            lv_label_set_text(icon, LV_SYMBOL_BULLET);  // Quiz
-        }
-        lv_obj_set_style_text_font(icon, &lv_font_montserrat_24, 0);
-        lv_obj_set_style_text_color(icon, i == selectedIndex ? UI_COLOR_PRIMARY : UI_COLOR_TEXT_SECONDARY, 0);
-        lv_obj_align(icon, LV_ALIGN_LEFT_MID, 10, 0);
+        // List container
+        ls.list = lv_obj_create(ls.screen);
+        lv_obj_set_size(ls.list, SCREEN_WIDTH, SCREEN_HEIGHT - 50);
+        lv_obj_set_pos(ls.list, 0, 50);
+        lv_obj_set_flex_flow(ls.list, LV_FLEX_FLOW_COLUMN);
+        lv_obj_set_style_pad_all(ls.list, 15, 0);
+        lv_obj_set_style_pad_row(ls.list, 15, 0);
+        lv_obj_set_style_bg_opa(ls.list, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(ls.list, 0, 0);
         
-        // Label
-        lv_obj_t* label = lv_label_create(item);
-        lv_label_set_text(label, items[i]);
-        lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
-        lv_obj_align(label, LV_ALIGN_LEFT_MID, 50, 0);
-        
-        // Arrow
-        lv_obj_t* arrow = lv_label_create(item);
-        lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
-        lv_obj_set_style_text_color(arrow, UI_COLOR_TEXT_MUTED, 0);
-        lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -10, 0);
+        // Footer hint
+        lv_obj_t* hint = lv_label_create(ls.screen);
+        lv_label_set_text(hint, "Use dial to navigate . Press A to select");
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_set_style_bg_color(hint, lv_color_hex(0x000000), 0); // Add bg to make readable over list
+        lv_obj_set_style_bg_opa(hint, LV_OPA_60, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
+        
+        createRows(ls, 70, [this](lv_obj_t* list) { return createMenuRow(list); });
+        built = true;
     }
     
-    // Footer hint
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, "Use dial to navigate . Press A to select");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_set_style_bg_color(hint, lv_color_hex(0x000000), 0); // Add bg to make readable over list
-    lv_obj_set_style_bg_opa(hint, LV_OPA_60, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
-    
-    loadScreen(scr);
+    syncList(ls, itemCount, selectedIndex, UI_COLOR_TEXT_SECONDARY, UI_COLOR_PRIMARY,
+             [items](lv_obj_t* row, int i) {
+        retext(lv_obj_get_child(row, 0), menuIcon(i));
+        retext(lv_obj_get_child(row, 1), items[i]);
+    });
+    showRetained(ls.screen);
+    logShowTime("Main menu", built, t0);
 }
 
 void UIManager::showLoading(const char* message) {
@@ -292,59 +647,46 @@ void UIManager::showLoading(const char* message) {
 }
 
 void UIManager::showExamList(const char** examNames, int count, int selectedIndex, const char* title) {
-    lv_obj_t* scr = createScreen();
-    
-    createHeader(scr, title, true);
-    
-    // List container
-    lv_obj_t* list = lv_obj_create(scr);
-    lv_obj_set_size(list, SCREEN_WIDTH - 20, SCREEN_HEIGHT - 70);
-    lv_obj_set_pos(list, 10, 55);
-    lv_obj_set_style_bg_opa(list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(list, 0, 0);
-    lv_obj_set_style_pad_all(list, 5, 0);
-    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_row(list, 10, 0);
-    
-    for (int i = 0; i < count; i++) {
-        lv_obj_t* item = lv_obj_create(list);
-        lv_obj_set_size(item, SCREEN_WIDTH - 50, 65);
+    uint32_t t0 = micros();
+    bool built = false;
+    VirtualList& ls = listScreen;
+    
+    // One screen serves the exam, deck and quiz lists - only the header differs
+    if (!ls.screen) {
+        ls.screen = createScreen();
+        lv_obj_t* header = createHeader(ls.screen, title, true);
+        ls.title = lv_obj_get_child(header, 0);
         
-        if (i == selectedIndex) {
-            lv_obj_add_style(item, &UITheme::style_list_item_selected, 0);
-        } else {
-            lv_obj_add_style(item, &UITheme::style_list_item, 0);
-        }
-        lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+        // List container
+        ls.list = lv_obj_create(ls.screen);
+        lv_obj_set_size(ls.list, SCREEN_WIDTH - 20, SCREEN_HEIGHT - 70);
+        lv_obj_set_pos(ls.list, 10, 55);
+        lv_obj_set_style_bg_opa(ls.list, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(ls.list, 0, 0);
+        lv_obj_set_style_pad_all(ls.list, 5, 0);
+        lv_obj_set_flex_flow(ls.list, LV_FLEX_FLOW_COLUMN);
+        lv_obj_set_style_pad_row(ls.list, 10, 0);
         
-        // Exam icon
-        lv_obj_t* icon = lv_label_create(item);
-        lv_label_set_text(icon, LV_SYMBOL_FILE);
-        lv_obj_set_style_text_font(icon, &lv_font_montserrat_22, 0);
-        lv_obj_set_style_text_color(icon, i == selectedIndex ? UI_COLOR_PRIMARY : UI_COLOR_SECONDARY, 0);
-        lv_obj_align(icon, LV_ALIGN_LEFT_MID, 5, 0);
-        
-        // Exam name
-        lv_obj_t* name = lv_label_create(item);
-        lv_label_set_text(name, examNames[i]);
-        lv_obj_set_style_text_font(name, &lv_font_montserrat_18, 0);
-        lv_label_set_long_mode(name, LV_LABEL_LONG_SCROLL_CIRCULAR);
-        lv_obj_set_width(name, SCREEN_WIDTH - 150);
-        lv_obj_align(name, LV_ALIGN_LEFT_MID, 45, 0);
-        
-        // Arrow
-        lv_obj_t* arrow = lv_label_create(item);
-        lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
-        lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -5, 0);
+        // Footer
+        lv_obj_t* hint = lv_label_create(ls.screen);
+        lv_label_set_text(hint, "A: Select   B: Back");
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -8);
+        
+        createRows(ls, 65, [this](lv_obj_t* list) { return createListRow(list); });
+        built = true;
+    } else {
+        retext(ls.title, title);
     }
     
-    // Footer
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, "A: Select   B: Back");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -8);
-    
-    loadScreen(scr);
+    // A list entered afresh starts from the top, like a new screen did
+    if (currentScreen != ls.screen) ls.first = 0;
+    syncList(ls, count, selectedIndex, UI_COLOR_SECONDARY, UI_COLOR_PRIMARY,
+             [examNames](lv_obj_t* row, int i) {
+        retext(lv_obj_get_child(row, 1), examNames[i]);
+    });
+    showRetained(ls.screen);
+    logShowTime("List", built, t0);
 }
 
 void UIManager::showTextInput(const char* title, const char* currentText, bool showCursor) {
@@ -384,7 +726,68 @@ void UIManager::showTextInput(const char* title, const char* currentText, bool s
 void UIManager::showQuestion(int qNum, int totalQ, const char* questionText, 
                               const char** options, int optionCount,
                               int pendingAnswer, int confirmedAnswer) {
+    uint32_t t0 = micros();
+    bool swapped = preparedQuestion.matches(qNum, totalQ, questionText, pendingAnswer, confirmedAnswer);
+    QuestionScreen built;
+    if (!swapped) {
+        buildQuestion(built, qNum, totalQ, questionText, options, optionCount, pendingAnswer, confirmedAnswer);
+    }
+    
+    const QuestionScreen& qs = swapped ? preparedQuestion : built;
+    progressLabel = qs.progressLabel;
+    questionLabel = qs.questionLabel;
+    memcpy(answerBtns, qs.answerBtns, sizeof(answerBtns));
+    loadScreen(qs.screen);
+    
+    // Now the current screen - loadScreen() deletes it once it is replaced
+    if (swapped) preparedQuestion = QuestionScreen();
+    logQuestionTime(qNum, swapped, t0);
+}
+
+void UIManager::prepareQuestion(int qNum, int totalQ, const char* questionText,
+                                 const char** options, int optionCount,
+                                 int pendingAnswer, int confirmedAnswer) {
+#if UI_PREPARE_NEXT_QUESTION
+    if (preparedQuestion.matches(qNum, totalQ, questionText, pendingAnswer, confirmedAnswer)) return;
+    discardPreparedQuestion();
+    
+    uint32_t t0 = micros();
+    buildQuestion(preparedQuestion, qNum, totalQ, questionText, options, optionCount, pendingAnswer, confirmedAnswer);
+    // Lay it out now too, so the swap is left with nothing but rendering
+    lv_obj_update_layout(preparedQuestion.screen);
+    if (settingsMgr.getSerialDebug()) {
+        Serial.printf("[UI] Question %d prepared in %lu us\n", qNum, micros() - t0);
+    }
+#endif
+}
+
+void UIManager::discardPreparedQuestion() {
+    if (preparedQuestion.screen) lv_obj_delete(preparedQuestion.screen);
+    preparedQuestion = QuestionScreen();
+}
+
+// Input-to-question latency with Serial Debug on. "built" lines are the old
+// on-demand path, "swapped in" lines a prepared screen.
+void UIManager::logQuestionTime(int qNum, bool swapped, uint32_t startUs) {
+    uint32_t now = micros();
+    if (settingsMgr.getSerialDebug()) {
+        Serial.printf("[UI] Question %d %s in %lu us", qNum, swapped ? "swapped in" : "built", now - startUs);
+        if (inputAtUs) Serial.printf(", %lu us after input", now - inputAtUs);
+        Serial.println();
+    }
+    inputAtUs = 0;
+}
+
+// Builds a question screen without loading it
+void UIManager::buildQuestion(QuestionScreen& qs, int qNum, int totalQ, const char* questionText,
+                              const char** options, int optionCount, int pendingAnswer, int confirmedAnswer) {
     lv_obj_t* scr = createScreen();
+    qs.screen = scr;
+    qs.qNum = qNum;
+    qs.totalQ = totalQ;
+    qs.text = questionText;
+    qs.pending = pendingAnswer;
+    qs.confirmed = confirmedAnswer;
     
     // Progress header
     lv_obj_t* header = lv_obj_create(scr);
@@ -396,11 +799,11 @@ void UIManager::showQuestion(int qNum, int totalQ, const char* questionText,
     // Question number
     char qNumStr[20];
     sprintf(qNumStr, "Question %d/%d", qNum, totalQ);
-    progressLabel = lv_label_create(header);
-    lv_label_set_text(progressLabel, qNumStr);
-    lv_obj_set_style_text_font(progressLabel, &lv_font_montserrat_18, 0);
-    lv_obj_set_style_text_color(progressLabel, UI_COLOR_TEXT_PRIMARY, 0);
-    lv_obj_align(progressLabel, LV_ALIGN_LEFT_MID, 15, 0);
+    qs.progressLabel = lv_label_create(header);
+    lv_label_set_text(qs.progressLabel, qNumStr);
+    lv_obj_set_style_text_font(qs.progressLabel, &lv_font_montserrat_18, 0);
+    lv_obj_set_style_text_color(qs.progressLabel, UI_COLOR_TEXT_PRIMARY, 0);
+    lv_obj_align(qs.progressLabel, LV_ALIGN_LEFT_MID, 15, 0);
     
     // Progress bar
     lv_obj_t* progressBar = lv_bar_create(header);
@@ -413,12 +816,12 @@ void UIManager::showQuestion(int qNum, int totalQ, const char* questionText,
     
     // Question text card
     lv_obj_t* qCard = createCard(scr, 15, 52, SCREEN_WIDTH - 30, 70);
-    questionLabel = lv_label_create(qCard);
-    lv_label_set_text(questionLabel, questionText);
-    lv_obj_set_style_text_font(questionLabel, &lv_font_montserrat_18, 0);
-    lv_label_set_long_mode(questionLabel, LV_LABEL_LONG_WRAP);
-    lv_obj_set_width(questionLabel, SCREEN_WIDTH - 70);
-    lv_obj_align(questionLabel, LV_ALIGN_TOP_LEFT, 0, 0);
+    qs.questionLabel = lv_label_create(qCard);
+    setLabelText(qs.questionLabel, questionText);
+    lv_obj_set_style_text_font(qs.questionLabel, &lv_font_montserrat_18, 0);
+    lv_label_set_long_mode(qs.questionLabel, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(qs.questionLabel, SCREEN_WIDTH - 70);
+    lv_obj_align(qs.questionLabel, LV_ALIGN_TOP_LEFT, 0, 0);
     
     // Answer buttons
     int startY = 130;
@@ -426,38 +829,38 @@ void UIManager::showQuestion(int qNum, int totalQ, const char* questionText,
     int spacing = 6;
     
     for (int i = 0; i < optionCount && i < 4; i++) {
-        answerBtns[i] = lv_button_create(scr);
-        lv_obj_set_size(answerBtns[i], SCREEN_WIDTH - 30, btnHeight);
-        lv_obj_set_pos(answerBtns[i], 15, startY + i * (btnHeight + spacing));
+        qs.answerBtns[i] = lv_button_create(scr);
+        lv_obj_set_size(qs.answerBtns[i], SCREEN_WIDTH - 30, btnHeight);
+        lv_obj_set_pos(qs.answerBtns[i], 15, startY + i * (btnHeight + spacing));
         
         // Determine state
         bool isPending = (pendingAnswer == i);
         bool isConfirmed = (confirmedAnswer == i);
         
-        lv_obj_add_style(answerBtns[i], &UITheme::style_btn_answer[i], 0);
+        lv_obj_add_style(qs.answerBtns[i], &UITheme::style_btn_answer[i], 0);
         
         if (isConfirmed) {
-            lv_obj_set_style_shadow_width(answerBtns[i], 15, 0);
-            lv_obj_set_style_border_width(answerBtns[i], 3, 0);
-            lv_obj_set_style_border_color(answerBtns[i], lv_color_white(), 0);
+            lv_obj_set_style_shadow_width(qs.answerBtns[i], 15, 0);
+            lv_obj_set_style_border_width(qs.answerBtns[i], 3, 0);
+            lv_obj_set_style_border_color(qs.answerBtns[i], lv_color_white(), 0);
         } else if (isPending) {
-            lv_obj_set_style_opa(answerBtns[i], LV_OPA_90, 0);
-            lv_obj_set_style_border_width(answerBtns[i], 2, 0);
-            lv_obj_set_style_border_color(answerBtns[i], UI_COLOR_WARNING, 0);
+            lv_obj_set_style_opa(qs.answerBtns[i], LV_OPA_90, 0);
+            lv_obj_set_style_border_width(qs.answerBtns[i], 2, 0);
+            lv_obj_set_style_border_color(qs.answerBtns[i], UI_COLOR_WARNING, 0);
         } else {
-            lv_obj_set_style_opa(answerBtns[i], LV_OPA_70, 0);
+            lv_obj_set_style_opa(qs.answerBtns[i], LV_OPA_70, 0);
         }
         
         // Letter
         const char* letters[] = {"A", "B", "C", "D"};
-        lv_obj_t* letterLabel = lv_label_create(answerBtns[i]);
+        lv_obj_t* letterLabel = lv_label_create(qs.answerBtns[i]);
         lv_label_set_text(letterLabel, letters[i]);
         lv_obj_set_style_text_font(letterLabel, &lv_font_montserrat_18, 0);
         lv_obj_align(letterLabel, LV_ALIGN_LEFT_MID, 12, 0);
         
         // Option text
-        lv_obj_t* optLabel = lv_label_create(answerBtns[i]);
-        lv_label_set_text(optLabel, options[i]);
+        lv_obj_t* optLabel = lv_label_create(qs.answerBtns[i]);
+        setLabelText(optLabel, options[i]);
         lv_obj_set_style_text_font(optLabel, &lv_font_montserrat_14, 0);
         lv_label_set_long_mode(optLabel, LV_LABEL_LONG_DOT);
         lv_obj_set_width(optLabel, SCREEN_WIDTH - 100);
@@ -478,8 +881,6 @@ void UIManager::showQuestion(int qNum, int totalQ, const char* questionText,
     }
     lv_obj_set_style_text_font(hint, &lv_font_montserrat_12, 0);
     lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -5);
-    
-    loadScreen(scr);
 }
 
 void UIManager::showPauseMenu(int selectedIndex) {
@@ -532,6 +933,24 @@ void UIManager::showPauseMenu(int selectedIndex) {
 }
 
 void UIManager::showOverview(int questionCount, int* answers, uint8_t* confirmed, int selectedIndex, int scrollOffset) {
+    uint32_t t0 = micros();
+    AnswerSheet& sheet = answerSheet;
+    
+    // Already up - answers cannot change here, only the cursor and window move
+    if (sheet.screen != nullptr && sheet.screen == currentScreen && sheet.count == questionCount) {
+        if (scrollOffset != sheet.first) {
+            sheet.first = scrollOffset;
+            lv_obj_invalidate(sheet.rows);
+        } else if (selectedIndex != sheet.selected) {
+            invalidateSheetRow(sheet.selected);
+            invalidateSheetRow(selectedIndex);
+        }
+        sheet.selected = selectedIndex;
+        lv_refr_now(display);
+        logShowTime("Overview", false, t0);
+        return;
+    }
+    
     lv_obj_t* scr = createScreen();
     
     createHeader(scr, "Answer Sheet", true);
@@ -566,108 +985,147 @@ void UIManager::showOverview(int questionCount, int* answers, uint8_t* confirmed
     lv_obj_add_style(pbar, &UITheme::style_progress_bg, LV_PART_MAIN);
     lv_obj_add_style(pbar, &UITheme::style_progress_indicator, LV_PART_INDICATOR);
     
-    // Grid of answers
-    int startY = 95;
-    int rowHeight = 38;
-    int maxVisible = 5;
+    // Grid of answers - one bare object, painted row by row in drawAnswerSheet
+    lv_obj_t* rows = lv_obj_create(scr);
+    lv_obj_remove_style_all(rows);
+    lv_obj_set_size(rows, SCREEN_WIDTH - 20, UI_OVERVIEW_ROWS * UI_OVERVIEW_ROW_HEIGHT);
+    lv_obj_set_pos(rows, 10, 95);
+    lv_obj_remove_flag(rows, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_remove_flag(rows, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(rows, drawAnswerSheet, LV_EVENT_DRAW_MAIN, this);
     
-    const char* optLabels = "ABCD";
+    // Legend
+    lv_obj_t* legend = lv_label_create(scr);
+    lv_label_set_text(legend, "Blue: Confirmed   Yellow: Pending   Gray: Empty");
+    lv_obj_set_style_text_font(legend, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(legend, UI_COLOR_TEXT_SECONDARY, 0);
+    lv_obj_align(legend, LV_ALIGN_BOTTOM_MID, 0, -25);
     
-    for (int row = 0; row < maxVisible && (scrollOffset + row) < questionCount; row++) {
-        int qIdx = scrollOffset + row;
-        int yPos = startY + row * rowHeight;
-        bool isSelected = (qIdx == selectedIndex);
+    // Footer
+    lv_obj_t* hint = lv_label_create(scr);
+    lv_label_set_text(hint, "Dial/[]: Navigate   A: Go to Question   B: Back");
+    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -5);
+    
+    sheet.rows = rows;
+    sheet.answers = answers;
+    sheet.confirmed = confirmed;
+    sheet.count = questionCount;
+    sheet.first = scrollOffset;
+    sheet.selected = selectedIndex;
+    loadScreen(scr);
+    sheet.screen = scr;
+    logShowTime("Overview", true, t0);
+}
+
+// Marks one question's row dirty, if it is in the window
+void UIManager::invalidateSheetRow(int question) {
+    int row = question - answerSheet.first;
+    if (row < 0 || row >= UI_OVERVIEW_ROWS) return;
+    lv_area_t area;
+    lv_obj_get_coords(answerSheet.rows, &area);
+    area.y1 += row * UI_OVERVIEW_ROW_HEIGHT;
+    area.y2 = area.y1 + UI_OVERVIEW_ROW_HEIGHT - 1;
+    lv_obj_invalidate_area(answerSheet.rows, &area);
+}
+
+// Centres one line of `text` in `area`
+static void drawCentredText(lv_layer_t* layer, const lv_area_t& area, const char* text,
+                            const lv_font_t* font, lv_color_t color, lv_text_align_t align) {
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.text = text;
+    dsc.font = font;
+    dsc.color = color;
+    dsc.align = align;
+    lv_area_t line = area;
+    line.y1 = area.y1 + (lv_area_get_height(&area) - lv_font_get_line_height(font)) / 2;
+    line.y2 = line.y1 + lv_font_get_line_height(font) - 1;
+    lv_draw_label(layer, &dsc, &line);
+}
+
+// Paints the visible rows straight from the exam's answer arrays. LVGL clips
+// every primitive to the dirty area, so a cursor move only costs the pixels
+// of the two rows that changed.
+void UIManager::drawAnswerSheet(lv_event_t* e) {
+    UIManager* ui = (UIManager*)lv_event_get_user_data(e);
+    AnswerSheet& sheet = ui->answerSheet;
+    lv_layer_t* layer = lv_event_get_layer(e);
+    static const char* const optLabels[4] = {"A", "B", "C", "D"};
+    
+    lv_area_t coords;
+    lv_obj_get_coords(sheet.rows, &coords);
+    
+    for (int row = 0; row < UI_OVERVIEW_ROWS && sheet.first + row < sheet.count; row++) {
+        int qIdx = sheet.first + row;
+        bool isSelected = (qIdx == sheet.selected);
         
-        // Row container
-        lv_obj_t* rowObj = lv_obj_create(scr);
-        lv_obj_set_size(rowObj, SCREEN_WIDTH - 20, rowHeight - 4);
-        lv_obj_set_pos(rowObj, 10, yPos);
-        lv_obj_set_style_pad_all(rowObj, 0, 0);  // Remove padding
+        // Row background
+        lv_area_t rowArea = coords;
+        rowArea.y1 = coords.y1 + row * UI_OVERVIEW_ROW_HEIGHT;
+        rowArea.y2 = rowArea.y1 + UI_OVERVIEW_ROW_HEIGHT - 5;
         
+        lv_draw_rect_dsc_t rect;
+        lv_draw_rect_dsc_init(&rect);
+        rect.radius = 8;
+        rect.bg_color = isSelected ? UI_COLOR_BG_ELEVATED : UI_COLOR_BG_CARD;
         if (isSelected) {
-            lv_obj_set_style_bg_color(rowObj, UI_COLOR_BG_ELEVATED, 0);
-            lv_obj_set_style_border_width(rowObj, 2, 0);
-            lv_obj_set_style_border_color(rowObj, UI_COLOR_PRIMARY, 0);
-        } else {
-            lv_obj_set_style_bg_color(rowObj, UI_COLOR_BG_CARD, 0);
-            lv_obj_set_style_border_width(rowObj, 0, 0);
+            rect.border_width = 2;
+            rect.border_color = UI_COLOR_PRIMARY;
         }
-        lv_obj_set_style_radius(rowObj, 8, 0);
-        lv_obj_remove_flag(rowObj, LV_OBJ_FLAG_SCROLLABLE);
-        
-        // Question number
-        char qNumStr[10];
-        sprintf(qNumStr, "%2d.", qIdx + 1);
-        lv_obj_t* qNumLbl = lv_label_create(rowObj);
-        lv_label_set_text(qNumLbl, qNumStr);
-        lv_obj_set_style_text_font(qNumLbl, &lv_font_montserrat_14, 0);
-        lv_obj_set_style_text_color(qNumLbl, UI_COLOR_TEXT_SECONDARY, 0);
-        lv_obj_align(qNumLbl, LV_ALIGN_LEFT_MID, 8, 0);
-        
-        // Answer bubbles - Optimized: Use labels directly
+        lv_draw_rect(layer, &rect, &rowArea);
+        
+        // Question number - kept in the sheet, the label draw may run after we return
+        snprintf(sheet.numbers[row], sizeof(sheet.numbers[row]), "%2d.", qIdx + 1);
+        lv_area_t numArea = rowArea;
+        numArea.x1 += 8;
+        numArea.x2 = numArea.x1 + 40;
+        drawCentredText(layer, numArea, sheet.numbers[row], &lv_font_montserrat_14,
+                        UI_COLOR_TEXT_SECONDARY, LV_TEXT_ALIGN_LEFT);
+        
+        // Answer bubbles
         for (int opt = 0; opt < 4; opt++) {
-            bool isFilled = (answers[qIdx] == opt);
-            bool isConf = confirmed[qIdx] && isFilled;
-            bool isPend = !confirmed[qIdx] && isFilled;
+            bool isFilled = (sheet.answers[qIdx] == opt);
             
-            char letter[2] = {optLabels[opt], 0};
-            lv_obj_t* bubble = lv_label_create(rowObj);
-            lv_label_set_text(bubble, letter);
-            lv_obj_set_size(bubble, 32, 26);
-            lv_obj_align(bubble, LV_ALIGN_LEFT_MID, 50 + opt * 42, 0);
+            lv_area_t bubble;
+            bubble.x1 = rowArea.x1 + 50 + opt * 42;
+            bubble.x2 = bubble.x1 + 31;
+            bubble.y1 = rowArea.y1 + (lv_area_get_height(&rowArea) - 26) / 2;
+            bubble.y2 = bubble.y1 + 25;
             
-            // Style to look like bubble
-            lv_obj_set_style_radius(bubble, 13, 0);
-            lv_obj_set_style_border_width(bubble, 0, 0);
-            lv_obj_set_style_text_align(bubble, LV_TEXT_ALIGN_CENTER, 0);
-            lv_obj_set_style_pad_top(bubble, 6, 0); // Center text vertically
-            
-            if (isConf) {
-                lv_obj_set_style_bg_color(bubble, UI_COLOR_CONFIRMED, 0);
-                lv_obj_set_style_bg_opa(bubble, LV_OPA_COVER, 0);
-            } else if (isPend) {
-                lv_obj_set_style_bg_color(bubble, UI_COLOR_PENDING, 0);
-                lv_obj_set_style_bg_opa(bubble, LV_OPA_COVER, 0);
+            lv_draw_rect_dsc_t dot;
+            lv_draw_rect_dsc_init(&dot);
+            dot.radius = 13;
+            if (isFilled && sheet.confirmed[qIdx]) {
+                dot.bg_color = UI_COLOR_CONFIRMED;
+            } else if (isFilled) {
+                dot.bg_color = UI_COLOR_PENDING;
             } else {
-                lv_obj_set_style_bg_color(bubble, UI_COLOR_EMPTY, 0);
-                lv_obj_set_style_bg_opa(bubble, LV_OPA_COVER, 0);
+                dot.bg_color = UI_COLOR_EMPTY;
             }
-            
-            lv_obj_set_style_text_font(bubble, &lv_font_montserrat_12, 0);
-            lv_obj_set_style_text_color(bubble, isFilled ? lv_color_white() : UI_COLOR_TEXT_MUTED, 0);
+            lv_draw_rect(layer, &dot, &bubble);
+            drawCentredText(layer, bubble, optLabels[opt], &lv_font_montserrat_12,
+                            isFilled ? lv_color_white() : UI_COLOR_TEXT_MUTED, LV_TEXT_ALIGN_CENTER);
         }
         
         // Status
-        lv_obj_t* statusLbl = lv_label_create(rowObj);
-        if (confirmed[qIdx]) {
-            lv_label_set_text(statusLbl, LV_SYMBOL_OK);
-            lv_obj_set_style_text_color(statusLbl, UI_COLOR_SUCCESS, 0);
-        } else if (answers[qIdx] >= 0) {
-            lv_label_set_text(statusLbl, LV_SYMBOL_REFRESH);
-            lv_obj_set_style_text_color(statusLbl, UI_COLOR_WARNING, 0);
+        const char* status;
+        lv_color_t statusColor;
+        if (sheet.confirmed[qIdx]) {
+            status = LV_SYMBOL_OK;
+            statusColor = UI_COLOR_SUCCESS;
+        } else if (sheet.answers[qIdx] >= 0) {
+            status = LV_SYMBOL_REFRESH;
+            statusColor = UI_COLOR_WARNING;
         } else {
-            lv_label_set_text(statusLbl, "-");
-            lv_obj_set_style_text_color(statusLbl, UI_COLOR_TEXT_MUTED, 0);
+            status = "-";
+            statusColor = UI_COLOR_TEXT_MUTED;
         }
-        lv_obj_align(statusLbl, LV_ALIGN_RIGHT_MID, -10, 0);
+        lv_area_t statusArea = rowArea;
+        statusArea.x2 -= 10;
+        statusArea.x1 = statusArea.x2 - 30;
+        drawCentredText(layer, statusArea, status, &lv_font_montserrat_14, statusColor, LV_TEXT_ALIGN_RIGHT);
     }
-    
-    // Legend
-    lv_obj_t* legend = lv_label_create(scr);
-    lv_label_set_text(legend, "Blue: Confirmed   Yellow: Pending   Gray: Empty");
-    lv_obj_set_style_text_font(legend, &lv_font_montserrat_12, 0);
-    lv_obj_set_style_text_color(legend, UI_COLOR_TEXT_SECONDARY, 0);
-    lv_obj_align(legend, LV_ALIGN_BOTTOM_MID, 0, -25);
-    
-    // Footer
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, "Dial/[]: Navigate   A: Go to Question   B: Back");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -5);
-    
-    Serial.println("[UI] Overview screen built");
-    loadScreen(scr);
-    Serial.println("[UI] Overview screen loaded");
 }
 
 void UIManager::showResult(int score, int total, float percentage) {
@@ -817,71 +1275,70 @@ void UIManager::showError(const char* message) {
 }
 
 void UIManager::showStudyTimer(unsigned long elapsedSeconds, bool isPaused, bool phoneDetected, bool userAway) {
-    lv_obj_t* scr = createScreen();
-    
-    createHeader(scr, "Study Session", false);
-    
-    // Status card
-    lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
-    
-    // Calculate time
-    int hours = elapsedSeconds / 3600;
-    int minutes = (elapsedSeconds % 3600) / 60;
-    int seconds = elapsedSeconds % 60;
-    
-    // Time display
-    char timeStr[20];
-    if (hours > 0) {
-        sprintf(timeStr, "%d:%02d:%02d", hours, minutes, seconds);
-    } else {
-        sprintf(timeStr, "%02d:%02d", minutes, seconds);
-    }
-    
-    lv_obj_t* timeLbl = lv_label_create(card);
-    lv_label_set_text(timeLbl, timeStr);
-    lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
+    uint32_t key = timerKey(TIMER_VIEW_STUDY, (phoneDetected << 2) | (userAway << 1) | isPaused);
+    lv_obj_t* scr = nullptr;
     
-    if (phoneDetected) {
-        lv_obj_set_style_text_color(timeLbl, UI_COLOR_ERROR, 0);
-    } else if (userAway || isPaused) {
-        lv_obj_set_style_text_color(timeLbl, UI_COLOR_WARNING, 0);
-    } else {
-        lv_obj_set_style_text_color(timeLbl, UI_COLOR_SUCCESS, 0);
-    }
-    lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 20);
-    
-    // Status message
-    lv_obj_t* statusLbl = lv_label_create(card);
-    const char* statusMsg;
-    lv_color_t statusColor;
-    
-    if (phoneDetected) {
-        statusMsg = "PHONE DETECTED!\nPut it away!";
-        statusColor = UI_COLOR_ERROR;
-    } else if (userAway) {
-        statusMsg = "USER AWAY\nTimer Paused";
-        statusColor = UI_COLOR_WARNING;
-    } else if (isPaused) {
-        statusMsg = "PAUSED\nPress A to Resume";
-        statusColor = UI_COLOR_WARNING;
-    } else {
-        statusMsg = "STUDYING\nStay focused!";
-        statusColor = UI_COLOR_SUCCESS;
+    if (!isTimerScreenFor(key)) {
+        scr = createScreen();
+        
+        createHeader(scr, "Study Session", false);
+        
+        // Status card
+        lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
+        
+        // Time display
+        lv_obj_t* timeLbl = lv_label_create(card);
+        lv_label_set_text(timeLbl, "");
+        lv_obj_set_width(timeLbl, lv_pct(100));
+        lv_obj_set_style_text_align(timeLbl, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
+        
+        if (phoneDetected) {
+            lv_obj_set_style_text_color(timeLbl, UI_COLOR_ERROR, 0);
+        } else if (userAway || isPaused) {
+            lv_obj_set_style_text_color(timeLbl, UI_COLOR_WARNING, 0);
+        } else {
+            lv_obj_set_style_text_color(timeLbl, UI_COLOR_SUCCESS, 0);
+        }
+        lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 20);
+        
+        // Status message
+        lv_obj_t* statusLbl = lv_label_create(card);
+        const char* statusMsg;
+        lv_color_t statusColor;
+        
+        if (phoneDetected) {
+            statusMsg = "PHONE DETECTED!\nPut it away!";
+            statusColor = UI_COLOR_ERROR;
+        } else if (userAway) {
+            statusMsg = "USER AWAY\nTimer Paused";
+            statusColor = UI_COLOR_WARNING;
+        } else if (isPaused) {
+            statusMsg = "PAUSED\nPress A to Resume";
+            statusColor = UI_COLOR_WARNING;
+        } else {
+            statusMsg = "STUDYING\nStay focused!";
+            statusColor = UI_COLOR_SUCCESS;
+        }
+        
+        lv_label_set_text(statusLbl, statusMsg);
+        lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_20, 0);
+        lv_obj_set_style_text_color(statusLbl, statusColor, 0);
+        lv_obj_set_style_text_align(statusLbl, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_align(statusLbl, LV_ALIGN_CENTER, 0, 20);
+        
+        // Footer hint
+        lv_obj_t* hint = lv_label_create(scr);
+        lv_label_set_text(hint, "A: Pause/Resume   B: Stop");
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -15);
+        
+        timerScreen.time = timeLbl;
+        timerScreen.arc = nullptr;
     }
     
-    lv_label_set_text(statusLbl, statusMsg);
-    lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_20, 0);
-    lv_obj_set_style_text_color(statusLbl, statusColor, 0);
-    lv_obj_set_style_text_align(statusLbl, LV_TEXT_ALIGN_CENTER, 0);
-    lv_obj_align(statusLbl, LV_ALIGN_CENTER, 0, 20);
-    
-    // Footer hint
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, "A: Pause/Resume   B: Stop");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -15);
-    
-    loadScreen(scr);
+    setTimerText(timerScreen.time, elapsedSeconds);
+    showTimerScreen(scr, key);
 }
 
 void UIManager::showStudyStart() {
@@ -957,7 +1414,7 @@ void UIManager::showFlashcardFront(const char* text, int current, int total) {
     lv_obj_t* card = createCard(scr, 20, 60, SCREEN_WIDTH - 40, 220);
     
     lv_obj_t* label = lv_label_create(card);
-    lv_label_set_text(label, text);
+    setLabelText(label, text);
     lv_obj_set_style_text_font(label, &lv_font_montserrat_22, 0);
     lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
     lv_label_set_long_mode(label, LV_LABEL_LONG_WRAP);
@@ -983,7 +1440,7 @@ void UIManager::showFlashcardBack(const char* front, const char* back) {
     lv_obj_set_style_bg_color(frontCard, UI_COLOR_BG_CARD, 0);
     
     lv_obj_t* frontLbl = lv_label_create(frontCard);
-    lv_label_set_text(frontLbl, front);
+    setLabelText(frontLbl, front);
     lv_obj_set_style_text_font(frontLbl, &lv_font_montserrat_16, 0);
     lv_obj_set_style_text_color(frontLbl, UI_COLOR_TEXT_SECONDARY, 0);
     lv_label_set_long_mode(frontLbl, LV_LABEL_LONG_DOT);
@@ -996,7 +1453,7 @@ void UIManager::showFlashcardBack(const char* front, const char* back) {
     lv_obj_set_style_border_width(backCard, 2, 0);
     
     lv_obj_t* backLbl = lv_label_create(backCard);
-    lv_label_set_text(backLbl, back);
+    setLabelText(backLbl, back);
     lv_obj_set_style_text_font(backLbl, &lv_font_montserrat_22, 0);
     lv_obj_set_style_text_align(backLbl, LV_TEXT_ALIGN_CENTER, 0);
     lv_label_set_long_mode(backLbl, LV_LABEL_LONG_WRAP);
@@ -1126,7 +1583,7 @@ void UIManager::showQuizQuestionText(int qNum, int total, const char* question,
     // Question Text
     lv_obj_t* qCard = createCard(scr, 20, 60, SCREEN_WIDTH - 40, 80);
     lv_obj_t* qLbl = lv_label_create(qCard);
-    lv_label_set_text(qLbl, question);
+    setLabelText(qLbl, question);
     lv_obj_set_style_text_font(qLbl, &lv_font_montserrat_18, 0);
     lv_label_set_long_mode(qLbl, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(qLbl, SCREEN_WIDTH - 80);
@@ -1176,7 +1633,7 @@ void UIManager::showQuizReview(int qNum, int total, const char* question, const
     // Question Text
     lv_obj_t* qCard = createCard(scr, 15, 85, SCREEN_WIDTH - 30, 70);
     lv_obj_t* qLbl = lv_label_create(qCard);
-    lv_label_set_text(qLbl, question);
+    setLabelText(qLbl, question);
     lv_obj_set_style_text_font(qLbl, &lv_font_montserrat_16, 0);
     lv_label_set_long_mode(qLbl, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(qLbl, SCREEN_WIDTH - 60);
@@ -1333,175 +1790,182 @@ void UIManager::showTimerSetup(int timerMode, int selectedIndex,
 }
 
 void UIManager::showBasicTimer(unsigned long elapsedSecs, unsigned long remainingSecs, bool isPaused, bool isBreak) {
-    lv_obj_t* scr = createScreen();
+    bool countdown = remainingSecs > 0;
+    uint32_t key = timerKey(TIMER_VIEW_BASIC, (countdown << 1) | isPaused);
+    lv_obj_t* scr = nullptr;
     
-    createHeader(scr, "Study Timer", false);
-    
-    // Main timer card
-    lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
-    
-    // Calculate display time
-    unsigned long displaySecs = remainingSecs > 0 ? remainingSecs : elapsedSecs;
-    int hours = displaySecs / 3600;
-    int minutes = (displaySecs % 3600) / 60;
-    int seconds = displaySecs % 60;
-    
-    // Large time display
-    char timeStr[20];
-    if (hours > 0) {
-        sprintf(timeStr, "%d:%02d:%02d", hours, minutes, seconds);
-    } else {
-        sprintf(timeStr, "%02d:%02d", minutes, seconds);
+    if (!isTimerScreenFor(key)) {
+        scr = createScreen();
+        
+        createHeader(scr, "Study Timer", false);
+        
+        // Main timer card
+        lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
+        
+        // Large time display
+        lv_obj_t* timeLbl = lv_label_create(card);
+        lv_label_set_text(timeLbl, "");
+        lv_obj_set_width(timeLbl, lv_pct(100));
+        lv_obj_set_style_text_align(timeLbl, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
+        lv_obj_set_style_text_color(timeLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_SUCCESS, 0);
+        lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 25);
+        
+        // Progress arc (for countdown mode)
+        lv_obj_t* arc = nullptr;
+        if (countdown) {
+            arc = lv_arc_create(card);
+            lv_obj_set_size(arc, 100, 100);
+            lv_obj_align(arc, LV_ALIGN_CENTER, 0, 20);
+            lv_arc_set_rotation(arc, 135);
+            lv_arc_set_bg_angles(arc, 0, 270);
+            lv_arc_set_range(arc, 0, 100);
+            lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+            lv_obj_set_style_arc_color(arc, UI_COLOR_BG_ELEVATED, LV_PART_MAIN);
+            lv_obj_set_style_arc_color(arc, isPaused ? UI_COLOR_WARNING : UI_COLOR_PRIMARY, LV_PART_INDICATOR);
+            lv_obj_remove_flag(arc, LV_OBJ_FLAG_CLICKABLE);
+        }
+        
+        // Status text
+        lv_obj_t* statusLbl = lv_label_create(card);
+        const char* statusText = isPaused ? "PAUSED" : (countdown ? "FOCUS TIME" : "STUDYING");
+        lv_label_set_text(statusLbl, statusText);
+        lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_18, 0);
+        lv_obj_set_style_text_color(statusLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_TEXT_SECONDARY, 0);
+        lv_obj_align(statusLbl, LV_ALIGN_BOTTOM_MID, 0, -15);
+        
+        // Footer hint
+        lv_obj_t* hint = lv_label_create(scr);
+        lv_label_set_text(hint, isPaused ? "A: Resume   B: Stop" : "A: Pause   B: Stop");
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
+        
+        timerScreen.time = timeLbl;
+        timerScreen.arc = arc;
     }
     
-    lv_obj_t* timeLbl = lv_label_create(card);
-    lv_label_set_text(timeLbl, timeStr);
-    lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
-    lv_obj_set_style_text_color(timeLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_SUCCESS, 0);
-    lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 25);
-    
-    // Progress arc (for countdown mode)
-    if (remainingSecs > 0) {
-        unsigned long totalSecs = elapsedSecs + remainingSecs;
-        int progress = (elapsedSecs * 100) / totalSecs;
-        
-        lv_obj_t* arc = lv_arc_create(card);
-        lv_obj_set_size(arc, 100, 100);
-        lv_obj_align(arc, LV_ALIGN_CENTER, 0, 20);
-        lv_arc_set_rotation(arc, 135);
-        lv_arc_set_bg_angles(arc, 0, 270);
-        lv_arc_set_range(arc, 0, 100);
-        lv_arc_set_value(arc, progress);
-        lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
-        lv_obj_set_style_arc_color(arc, UI_COLOR_BG_ELEVATED, LV_PART_MAIN);
-        lv_obj_set_style_arc_color(arc, isPaused ? UI_COLOR_WARNING : UI_COLOR_PRIMARY, LV_PART_INDICATOR);
-        lv_obj_remove_flag(arc, LV_OBJ_FLAG_CLICKABLE);
+    // Countdown shows what is left, count-up what has passed
+    setTimerText(timerScreen.time, countdown ? remainingSecs : elapsedSecs);
+    if (timerScreen.arc) {
+        // Same value is a no-op; a new one invalidates only the swept angle
+        lv_arc_set_value(timerScreen.arc, (elapsedSecs * 100) / (elapsedSecs + remainingSecs));
     }
-    
-    // Status text
-    lv_obj_t* statusLbl = lv_label_create(card);
-    const char* statusText = isPaused ? "PAUSED" : (remainingSecs > 0 ? "FOCUS TIME" : "STUDYING");
-    lv_label_set_text(statusLbl, statusText);
-    lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_18, 0);
-    lv_obj_set_style_text_color(statusLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_TEXT_SECONDARY, 0);
-    lv_obj_align(statusLbl, LV_ALIGN_BOTTOM_MID, 0, -15);
-    
-    // Footer hint
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, isPaused ? "A: Resume   B: Stop" : "A: Pause   B: Stop");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
-    
-    loadScreen(scr);
+    showTimerScreen(scr, key);
 }
 
 void UIManager::showPomodoroTimer(unsigned long remainingSecs, int phase, int currentSession, int totalSessions, bool isPaused, bool isBreak) {
-    lv_obj_t* scr = createScreen();
-    
-    // Phase-based header color
-    const char* phaseTitle;
-    lv_color_t phaseColor;
-    
-    switch (phase) {
-        case UI_POMO_WORK:
-            phaseTitle = "Focus Time";
-            phaseColor = UI_COLOR_PRIMARY;
-            break;
-        case UI_POMO_SHORT_BREAK:
-            phaseTitle = "Short Break";
-            phaseColor = UI_COLOR_SUCCESS;
-            break;
-        case UI_POMO_LONG_BREAK:
-            phaseTitle = "Long Break";
-            phaseColor = UI_COLOR_SECONDARY;
-            break;
-        default:
-            phaseTitle = "Pomodoro";
-            phaseColor = UI_COLOR_PRIMARY;
-    }
+    uint32_t key = timerKey(TIMER_VIEW_POMODORO, (phase << 2) | (isBreak << 1) | isPaused,
+                            currentSession, totalSessions);
+    lv_obj_t* scr = nullptr;
     
-    // Custom header with phase color
-    lv_obj_t* header = lv_obj_create(scr);
-    lv_obj_set_size(header, SCREEN_WIDTH, 50);
-    lv_obj_set_pos(header, 0, 0);
-    lv_obj_set_style_bg_color(header, phaseColor, 0);
-    lv_obj_set_style_radius(header, 0, 0);
-    lv_obj_set_style_border_width(header, 0, 0);
-    lv_obj_remove_flag(header, LV_OBJ_FLAG_SCROLLABLE);
-    
-    lv_obj_t* titleLbl = lv_label_create(header);
-    lv_label_set_text(titleLbl, phaseTitle);
-    lv_obj_set_style_text_font(titleLbl, &lv_font_montserrat_22, 0);
-    lv_obj_set_style_text_color(titleLbl, lv_color_white(), 0);
-    lv_obj_align(titleLbl, LV_ALIGN_LEFT_MID, 15, 0);
-    
-    // Session counter in header
-    char sessStr[20];
-    sprintf(sessStr, "%d/%d", currentSession, totalSessions);
-    lv_obj_t* sessLbl = lv_label_create(header);
-    lv_label_set_text(sessLbl, sessStr);
-    lv_obj_set_style_text_font(sessLbl, &lv_font_montserrat_18, 0);
-    lv_obj_set_style_text_color(sessLbl, lv_color_white(), 0);
-    lv_obj_align(sessLbl, LV_ALIGN_RIGHT_MID, -15, 0);
-    
-    // Main timer card
-    lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
-    
-    // Calculate time
-    int minutes = remainingSecs / 60;
-    int seconds = remainingSecs % 60;
-    
-    char timeStr[10];
-    sprintf(timeStr, "%02d:%02d", minutes, seconds);
-    
-    lv_obj_t* timeLbl = lv_label_create(card);
-    lv_label_set_text(timeLbl, timeStr);
-    lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
-    lv_obj_set_style_text_color(timeLbl, isPaused ? UI_COLOR_WARNING : phaseColor, 0);
-    lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 30);
-    
-    // Tomato icons for sessions completed
-    lv_obj_t* tomatoRow = lv_obj_create(card);
-    lv_obj_set_size(tomatoRow, SCREEN_WIDTH - 100, 40);
-    lv_obj_align(tomatoRow, LV_ALIGN_CENTER, 0, 20);
-    lv_obj_set_style_bg_opa(tomatoRow, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(tomatoRow, 0, 0);
-    lv_obj_set_flex_flow(tomatoRow, LV_FLEX_FLOW_ROW);
-    lv_obj_set_flex_align(tomatoRow, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
-    lv_obj_remove_flag(tomatoRow, LV_OBJ_FLAG_SCROLLABLE);
-    
-    for (int i = 0; i < totalSessions && i < 8; i++) {
-        lv_obj_t* tomato = lv_label_create(tomatoRow);
-        lv_label_set_text(tomato, LV_SYMBOL_CHARGE); // Using charge as tomato substitute
-        lv_obj_set_style_text_font(tomato, &lv_font_montserrat_20, 0);
-        if (i < currentSession - 1 || (i == currentSession - 1 && phase != UI_POMO_WORK)) {
-            lv_obj_set_style_text_color(tomato, UI_COLOR_SUCCESS, 0); // Completed
-        } else if (i == currentSession - 1) {
-            lv_obj_set_style_text_color(tomato, phaseColor, 0); // Current
+    if (!isTimerScreenFor(key)) {
+        scr = createScreen();
+        
+        // Phase-based header color
+        const char* phaseTitle;
+        lv_color_t phaseColor;
+        
+        switch (phase) {
+            case UI_POMO_WORK:
+                phaseTitle = "Focus Time";
+                phaseColor = UI_COLOR_PRIMARY;
+                break;
+            case UI_POMO_SHORT_BREAK:
+                phaseTitle = "Short Break";
+                phaseColor = UI_COLOR_SUCCESS;
+                break;
+            case UI_POMO_LONG_BREAK:
+                phaseTitle = "Long Break";
+                phaseColor = UI_COLOR_SECONDARY;
+                break;
+            default:
+                phaseTitle = "Pomodoro";
+                phaseColor = UI_COLOR_PRIMARY;
+        }
+        
+        // Custom header with phase color
+        lv_obj_t* header = lv_obj_create(scr);
+        lv_obj_set_size(header, SCREEN_WIDTH, 50);
+        lv_obj_set_pos(header, 0, 0);
+        lv_obj_set_style_bg_color(header, phaseColor, 0);
+        lv_obj_set_style_radius(header, 0, 0);
+        lv_obj_set_style_border_width(header, 0, 0);
+        lv_obj_remove_flag(header, LV_OBJ_FLAG_SCROLLABLE);
+        
+        lv_obj_t* titleLbl = lv_label_create(header);
+        lv_label_set_text(titleLbl, phaseTitle);
+        lv_obj_set_style_text_font(titleLbl, &lv_font_montserrat_22, 0);
+        lv_obj_set_style_text_color(titleLbl, lv_color_white(), 0);
+        lv_obj_align(titleLbl, LV_ALIGN_LEFT_MID, 15, 0);
+        
+        // Session counter in header
+        lv_obj_t* sessLbl = lv_label_create(header);
+        lv_label_set_text_fmt(sessLbl, "%d/%d", currentSession, totalSessions);
+        lv_obj_set_style_text_font(sessLbl, &lv_font_montserrat_18, 0);
+        lv_obj_set_style_text_color(sessLbl, lv_color_white(), 0);
+        lv_obj_align(sessLbl, LV_ALIGN_RIGHT_MID, -15, 0);
+        
+        // Main timer card
+        lv_obj_t* card = createCard(scr, 30, 60, SCREEN_WIDTH - 60, 200);
+        
+        lv_obj_t* timeLbl = lv_label_create(card);
+        lv_label_set_text(timeLbl, "");
+        lv_obj_set_width(timeLbl, lv_pct(100));
+        lv_obj_set_style_text_align(timeLbl, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_32, 0);
+        lv_obj_set_style_text_color(timeLbl, isPaused ? UI_COLOR_WARNING : phaseColor, 0);
+        lv_obj_align(timeLbl, LV_ALIGN_TOP_MID, 0, 30);
+        
+        // Tomato icons for sessions completed
+        lv_obj_t* tomatoRow = lv_obj_create(card);
+        lv_obj_set_size(tomatoRow, SCREEN_WIDTH - 100, 40);
+        lv_obj_align(tomatoRow, LV_ALIGN_CENTER, 0, 20);
+        lv_obj_set_style_bg_opa(tomatoRow, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(tomatoRow, 0, 0);
+        lv_obj_set_flex_flow(tomatoRow, LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(tomatoRow, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+        lv_obj_remove_flag(tomatoRow, LV_OBJ_FLAG_SCROLLABLE);
+        
+        for (int i = 0; i < totalSessions && i < 8; i++) {
+            lv_obj_t* tomato = lv_label_create(tomatoRow);
+            lv_label_set_text(tomato, LV_SYMBOL_CHARGE); // Using charge as tomato substitute
+            lv_obj_set_style_text_font(tomato, &lv_font_montserrat_20, 0);
+            if (i < currentSession - 1 || (i == currentSession - 1 && phase != UI_POMO_WORK)) {
+                lv_obj_set_style_text_color(tomato, UI_COLOR_SUCCESS, 0); // Completed
+            } else if (i == currentSession - 1) {
+                lv_obj_set_style_text_color(tomato, phaseColor, 0); // Current
+            } else {
+                lv_obj_set_style_text_color(tomato, UI_COLOR_TEXT_MUTED, 0); // Not started
+            }
+        }
+        
+        // Status text
+        lv_obj_t* statusLbl = lv_label_create(card);
+        const char* statusText = isPaused ? "PAUSED" : (isBreak ? "Take a break!" : "Stay focused!");
+        lv_label_set_text(statusLbl, statusText);
+        lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_16, 0);
+        lv_obj_set_style_text_color(statusLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_TEXT_SECONDARY, 0);
+        lv_obj_align(statusLbl, LV_ALIGN_BOTTOM_MID, 0, -15);
+        
+        // Footer hint
+        lv_obj_t* hint = lv_label_create(scr);
+        if (isBreak) {
+            lv_label_set_text(hint, "A: Skip Break   B: Stop");
         } else {
-            lv_obj_set_style_text_color(tomato, UI_COLOR_TEXT_MUTED, 0); // Not started
+            lv_label_set_text(hint, isPaused ? "A: Resume   B: Stop" : "A: Pause   B: Stop");
         }
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
+        
+        timerScreen.time = timeLbl;
+        timerScreen.arc = nullptr;
     }
     
-    // Status text
-    lv_obj_t* statusLbl = lv_label_create(card);
-    const char* statusText = isPaused ? "PAUSED" : (isBreak ? "Take a break!" : "Stay focused!");
-    lv_label_set_text(statusLbl, statusText);
-    lv_obj_set_style_text_font(statusLbl, &lv_font_montserrat_16, 0);
-    lv_obj_set_style_text_color(statusLbl, isPaused ? UI_COLOR_WARNING : UI_COLOR_TEXT_SECONDARY, 0);
-    lv_obj_align(statusLbl, LV_ALIGN_BOTTOM_MID, 0, -15);
-    
-    // Footer hint
-    lv_obj_t* hint = lv_label_create(scr);
-    if (isBreak) {
-        lv_label_set_text(hint, "A: Skip Break   B: Stop");
-    } else {
-        lv_label_set_text(hint, isPaused ? "A: Resume   B: Stop" : "A: Pause   B: Stop");
-    }
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -10);
-    
-    loadScreen(scr);
+    // Phases are minutes long - shown as MM:SS even past the hour
+    char timeStr[10];
+    snprintf(timeStr, sizeof(timeStr), "%02lu:%02lu", remainingSecs / 60, remainingSecs % 60);
+    if (strcmp(lv_label_get_text(timerScreen.time), timeStr) != 0) lv_label_set_text(timerScreen.time, timeStr);
+    showTimerScreen(scr, key);
 }
 
 void UIManager::showTimerComplete(int sessionsCompleted, unsigned long totalSeconds) {
@@ -1805,10 +2269,19 @@ void UIManager::showAdminURL(const char* url) {
 // DEV MODE MENU
 // ===================================================================================
 
-void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool serialDebug, bool showFPS, bool verboseNet) {
+void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool serialDebug, bool showFPS, bool verboseNet,
+                                const char* wifiInfo) {
     lv_obj_t* scr = createScreen();
     
-    createHeader(scr, "Developer Mode", true);
+    lv_obj_t* header = createHeader(scr, "Developer Mode", true);
+    
+    // Last WiFi connect time (boot or reconnect)
+    if (wifiInfo) {
+        lv_obj_t* info = lv_label_create(header);
+        lv_label_set_text(info, wifiInfo);
+        lv_obj_add_style(info, &UITheme::style_text_small, 0);
+        lv_obj_align(info, LV_ALIGN_RIGHT_MID, -12, 0);
+    }
     
     // Settings list
     lv_obj_t* list = lv_obj_create(scr);
@@ -1820,11 +2293,12 @@ void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool seri
     lv_obj_set_style_pad_row(list, 8, 0);
     lv_obj_set_style_pad_all(list, 5, 0);
     
-    // Menu items (7 items now)
-    const char* labels[] = {"API Base URL", "Serial Debug", "Show FPS", "Verbose Network", "Hardware Tests", "Reset All Settings", "Back"};
-    const char* icons[] = {LV_SYMBOL_UPLOAD, LV_SYMBOL_LIST, LV_SYMBOL_CHARGE, LV_SYMBOL_DOWNLOAD, LV_SYMBOL_SETTINGS, LV_SYMBOL_REFRESH, LV_SYMBOL_LEFT};
-    bool toggles[] = {false, serialDebug, showFPS, verboseNet, false, false, false};
-    int itemCount = 7;
+    // Menu items (8 items now)
+    const char* labels[] = {"API Base URL", "Serial Debug", "Show FPS", "Verbose Network", "Hardware Tests", "Network Stats", "Reset All Settings", "Back"};
+    const char* icons[] = {LV_SYMBOL_UPLOAD, LV_SYMBOL_LIST, LV_SYMBOL_CHARGE, LV_SYMBOL_DOWNLOAD, LV_SYMBOL_SETTINGS, LV_SYMBOL_WIFI, LV_SYMBOL_REFRESH, LV_SYMBOL_LEFT};
+    bool toggles[] = {false, serialDebug, showFPS, verboseNet, false, false, false, false};
+    int itemCount = 8;
+    lv_obj_t* selectedItem = nullptr;
     
     for (int i = 0; i < itemCount; i++) {
         lv_obj_t* item = lv_obj_create(list);
@@ -1832,6 +2306,7 @@ void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool seri
         
         if (i == selectedIndex) {
             lv_obj_add_style(item, &UITheme::style_list_item_selected, 0);
+            selectedItem = item;
         } else {
             lv_obj_add_style(item, &UITheme::style_list_item, 0);
         }
@@ -1876,19 +2351,22 @@ void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool seri
             lv_obj_set_style_text_color(toggle, toggles[i] ? UI_COLOR_SUCCESS : UI_COLOR_TEXT_MUTED, 0);
             lv_obj_align(toggle, LV_ALIGN_RIGHT_MID, -12, 0);
         }
-        // Hardware Tests (item 4) - show arrow
-        else if (i == 4) {
+        // Hardware Tests / Network Stats (items 4-5) - show arrow
+        else if (i == 4 || i == 5) {
             lv_obj_t* arrow = lv_label_create(item);
             lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
             lv_obj_set_style_text_color(arrow, UI_COLOR_TEXT_MUTED, 0);
             lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -8, 0);
         }
-        // Reset settings (item 5) - warning color
-        else if (i == 5) {
+        // Reset settings (item 6) - warning color
+        else if (i == 6) {
             lv_obj_set_style_text_color(icon, UI_COLOR_WARNING, 0);
         }
     }
     
+    // The list is taller than the screen - keep the selection visible
+    if (selectedItem) lv_obj_scroll_to_view(selectedItem, LV_ANIM_OFF);
+    
     // Footer hint
     lv_obj_t* hint = lv_label_create(scr);
     lv_label_set_text(hint, "Dial: Navigate   A: Toggle/Edit   B: Back");
@@ -1898,6 +2376,72 @@ void UIManager::showDevModeMenu(int selectedIndex, const char* apiUrl, bool seri
     loadScreen(scr);
 }
 
+// ===================================================================================
+// NETWORK STATS
+// ===================================================================================
+
+void UIManager::showNetworkStats(const char* summary, const char* cells[][UI_STATS_COLS], int rowCount,
+                                 const char* lastRequest) {
+    lv_obj_t* scr = createScreen();
+    
+    createHeader(scr, "Network Stats", true);
+    
+    lv_obj_t* sum = lv_label_create(scr);
+    lv_label_set_text(sum, summary);
+    lv_obj_add_style(sum, &UITheme::style_text_small, 0);
+    lv_obj_set_pos(sum, 10, 56);
+    
+    // Per-endpoint averages - connect vs TTFB separates hotspot from backend
+    static const char* headings[UI_STATS_COLS] = {"Endpoint", "N", "Conn", "TTFB", "Xfer", "Parse", "<100/250/500/1s/2s/+"};
+    static const int colX[UI_STATS_COLS] = {10, 150, 185, 230, 275, 320, 365};
+    const int rowH = 17;
+    
+    for (int c = 0; c < UI_STATS_COLS; c++) {
+        lv_obj_t* h = lv_label_create(scr);
+        lv_label_set_text(h, headings[c]);
+        lv_obj_set_style_text_font(h, &lv_font_montserrat_12, 0);
+        lv_obj_set_style_text_color(h, UI_COLOR_PRIMARY, 0);
+        lv_obj_set_pos(h, colX[c], 78);
+    }
+    
+    if (rowCount > UI_STATS_MAX_ROWS) rowCount = UI_STATS_MAX_ROWS;
+    for (int r = 0; r < rowCount; r++) {
+        for (int c = 0; c < UI_STATS_COLS; c++) {
+            lv_obj_t* cell = lv_label_create(scr);
+            lv_label_set_text(cell, cells[r][c]);
+            lv_obj_set_style_text_font(cell, &lv_font_montserrat_12, 0);
+            lv_obj_set_style_text_color(cell, c == 0 ? UI_COLOR_TEXT_PRIMARY : UI_COLOR_TEXT_SECONDARY, 0);
+            if (c == 0) {
+                lv_obj_set_width(cell, colX[1] - colX[0] - 4);
+                lv_label_set_long_mode(cell, LV_LABEL_LONG_DOT);
+            }
+            lv_obj_set_pos(cell, colX[c], 96 + r * rowH);
+        }
+    }
+    
+    if (rowCount == 0) {
+        lv_obj_t* empty = lv_label_create(scr);
+        lv_label_set_text(empty, "No requests yet");
+        lv_obj_add_style(empty, &UITheme::style_text_body, 0);
+        lv_obj_align(empty, LV_ALIGN_CENTER, 0, 0);
+    }
+    
+    // Full breakdown of the most recent request
+    lv_obj_t* last = lv_label_create(scr);
+    lv_label_set_text(last, lastRequest);
+    lv_obj_set_style_text_font(last, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(last, UI_COLOR_TEXT_MUTED, 0);
+    lv_obj_set_width(last, SCREEN_WIDTH - 20);
+    lv_obj_set_pos(last, 10, SCREEN_HEIGHT - 58);
+    
+    lv_obj_t* hint = lv_label_create(scr);
+    lv_label_set_text(hint, "A: Reset   B: Back   (times: avg ms)");
+    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -8);
+    
+    loadScreen(scr);
+}
+
 // ===================================================================================
 // API URL EDITOR
 // ===================================================================================
@@ -2170,73 +2714,43 @@ void UIManager::showTestResult(const char* testName, bool passed, const char* de
 // ===================================================================================
 
 void UIManager::showTranscriptList(const char** titles, const char** dates, int count, int selectedIndex) {
-    lv_obj_t* scr = createScreen();
-    
-    createHeader(scr, "Transcripts", true);
-    
-    // Scrollable list container
-    lv_obj_t* list = lv_obj_create(scr);
-    lv_obj_set_size(list, SCREEN_WIDTH - 20, SCREEN_HEIGHT - 85);
-    lv_obj_set_pos(list, 10, 55);
-    lv_obj_set_style_bg_opa(list, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_border_width(list, 0, 0);
-    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
-    lv_obj_set_style_pad_row(list, 8, 0);
-    lv_obj_set_style_pad_all(list, 5, 0);
-    
-    for (int i = 0; i < count; i++) {
-        lv_obj_t* item = lv_obj_create(list);
-        lv_obj_set_size(item, SCREEN_WIDTH - 45, 52);
+    uint32_t t0 = micros();
+    bool built = false;
+    VirtualList& ls = transcriptScreen;
+    
+    if (!ls.screen) {
+        ls.screen = createScreen();
+        lv_obj_t* header = createHeader(ls.screen, "Transcripts", true);
+        ls.title = lv_obj_get_child(header, 0);
         
-        if (i == selectedIndex) {
-            lv_obj_add_style(item, &UITheme::style_list_item_selected, 0);
-        } else {
-            lv_obj_add_style(item, &UITheme::style_list_item, 0);
-        }
-        lv_obj_remove_flag(item, LV_OBJ_FLAG_SCROLLABLE);
+        // List container
+        ls.list = lv_obj_create(ls.screen);
+        lv_obj_set_size(ls.list, SCREEN_WIDTH - 20, SCREEN_HEIGHT - 85);
+        lv_obj_set_pos(ls.list, 10, 55);
+        lv_obj_set_style_bg_opa(ls.list, LV_OPA_TRANSP, 0);
+        lv_obj_set_style_border_width(ls.list, 0, 0);
+        lv_obj_set_flex_flow(ls.list, LV_FLEX_FLOW_COLUMN);
+        lv_obj_set_style_pad_row(ls.list, 8, 0);
+        lv_obj_set_style_pad_all(ls.list, 5, 0);
         
-        // Microphone icon
-        lv_obj_t* icon = lv_label_create(item);
-        lv_label_set_text(icon, LV_SYMBOL_AUDIO);
-        lv_obj_set_style_text_font(icon, &lv_font_montserrat_20, 0);
-        lv_obj_set_style_text_color(icon, i == selectedIndex ? UI_COLOR_PRIMARY : UI_COLOR_TEXT_SECONDARY, 0);
-        lv_obj_align(icon, LV_ALIGN_LEFT_MID, 8, 0);
+        // Footer
+        lv_obj_t* hint = lv_label_create(ls.screen);
+        lv_label_set_text(hint, "Dial: Select   A: Open   B: Back");
+        lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+        lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -8);
         
-        // Title
-        lv_obj_t* titleLbl = lv_label_create(item);
-        lv_label_set_text(titleLbl, titles[i]);
-        lv_obj_set_style_text_font(titleLbl, &lv_font_montserrat_16, 0);
-        lv_obj_set_style_text_color(titleLbl, UI_COLOR_TEXT_PRIMARY, 0);
-        lv_obj_set_width(titleLbl, SCREEN_WIDTH - 120);
-        lv_label_set_long_mode(titleLbl, LV_LABEL_LONG_DOT);
-        lv_obj_align(titleLbl, LV_ALIGN_LEFT_MID, 40, -8);
-        
-        // Date
-        lv_obj_t* dateLbl = lv_label_create(item);
-        lv_label_set_text(dateLbl, dates[i]);
-        lv_obj_set_style_text_font(dateLbl, &lv_font_montserrat_12, 0);
-        lv_obj_set_style_text_color(dateLbl, UI_COLOR_TEXT_MUTED, 0);
-        lv_obj_align(dateLbl, LV_ALIGN_LEFT_MID, 40, 10);
-        
-        // Arrow
-        lv_obj_t* arrow = lv_label_create(item);
-        lv_label_set_text(arrow, LV_SYMBOL_RIGHT);
-        lv_obj_set_style_text_color(arrow, UI_COLOR_TEXT_MUTED, 0);
-        lv_obj_align(arrow, LV_ALIGN_RIGHT_MID, -10, 0);
+        createRows(ls, 52, [this](lv_obj_t* list) { return createTranscriptRow(list); });
+        built = true;
     }
     
-    // Scroll to selected item
-    if (selectedIndex > 0) {
-        lv_obj_scroll_to_y(list, selectedIndex * 60 - 30, LV_ANIM_OFF);
-    }
-    
-    // Footer
-    lv_obj_t* hint = lv_label_create(scr);
-    lv_label_set_text(hint, "Dial: Select   A: Open   B: Back");
-    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
-    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -8);
-    
-    loadScreen(scr);
+    if (currentScreen != ls.screen) ls.first = 0;
+    syncList(ls, count, selectedIndex, UI_COLOR_TEXT_SECONDARY, UI_COLOR_PRIMARY,
+             [titles, dates](lv_obj_t* row, int i) {
+        retext(lv_obj_get_child(row, 1), titles[i]);
+        retext(lv_obj_get_child(row, 2), dates[i]);
+    });
+    showRetained(ls.screen);
+    logShowTime("Transcripts", built, t0);
 }
 
 void UIManager::showTranscriptOptions(const char* title, int selectedIndex) {
@@ -2373,3 +2887,60 @@ void UIManager::showSuccess(const char* title, const char* message) {
     
     loadScreen(scr);
 }
+
+void UIManager::showGenerationProgress(const char* title) {
+    lv_obj_t* scr = createScreen();
+    
+    createHeader(scr, title, false);
+    
+    // Spinner keeps turning while the worker waits on the backend
+    lv_obj_t* spinner = lv_spinner_create(scr);
+    lv_obj_set_size(spinner, 70, 70);
+    lv_obj_align(spinner, LV_ALIGN_TOP_MID, 0, 65);
+    lv_obj_set_style_arc_width(spinner, 8, LV_PART_MAIN);
+    lv_obj_set_style_arc_width(spinner, 8, LV_PART_INDICATOR);
+    lv_obj_set_style_arc_color(spinner, UI_COLOR_BG_CARD, LV_PART_MAIN);
+    lv_obj_set_style_arc_color(spinner, UI_COLOR_PRIMARY, LV_PART_INDICATOR);
+    
+    // Server-reported status
+    genStatusLabel = lv_label_create(scr);
+    lv_label_set_text(genStatusLabel, "Starting...");
+    lv_obj_add_style(genStatusLabel, &UITheme::style_text_body, 0);
+    lv_obj_set_style_text_align(genStatusLabel, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_width(genStatusLabel, SCREEN_WIDTH - 60);
+    lv_obj_align(genStatusLabel, LV_ALIGN_TOP_MID, 0, 150);
+    
+    // Estimated progress (the backend does not report a percentage)
+    genBar = lv_bar_create(scr);
+    lv_obj_set_size(genBar, SCREEN_WIDTH - 120, 10);
+    lv_obj_align(genBar, LV_ALIGN_TOP_MID, 0, 190);
+    lv_bar_set_range(genBar, 0, 100);
+    lv_bar_set_value(genBar, 0, LV_ANIM_OFF);
+    lv_obj_add_style(genBar, &UITheme::style_progress_bg, LV_PART_MAIN);
+    lv_obj_add_style(genBar, &UITheme::style_progress_indicator, LV_PART_INDICATOR);
+    
+    genElapsedLabel = lv_label_create(scr);
+    lv_label_set_text(genElapsedLabel, "0s");
+    lv_obj_add_style(genElapsedLabel, &UITheme::style_text_small, 0);
+    lv_obj_align(genElapsedLabel, LV_ALIGN_TOP_MID, 0, 210);
+    
+    // Footer
+    lv_obj_t* hint = lv_label_create(scr);
+    lv_label_set_text(hint, "B: Cancel");
+    lv_obj_add_style(hint, &UITheme::style_text_small, 0);
+    lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -15);
+    
+    loadScreen(scr);
+    genScreen = scr;
+}
+
+void UIManager::updateGenerationProgress(const char* status, unsigned long elapsedSecs, int estimatePct) {
+    // Another screen (e.g. a focus warning) replaced ours - objects are gone
+    if (genScreen == nullptr || genScreen != currentScreen) return;
+    
+    if (status && strcmp(lv_label_get_text(genStatusLabel), status) != 0) {
+        lv_label_set_text(genStatusLabel, status);
+    }
+    lv_label_set_text_fmt(genElapsedLabel, "%lus", elapsedSecs);
+    lv_bar_set_value(genBar, estimatePct, LV_ANIM_ON);
+}
@@ -9,12 +9,42 @@
 
 #include <lvgl.h>
 #include <TFT_eSPI.h>
+#include <vector>
 #include "UITheme.h"
+#include "FrameStats.h"
 #include "config.h"
 
 // Forward declare
 class InputManager;
 
+// Two DMA draw buffers of this many lines each (RGB565)
+#define UI_DRAW_BUF_LINES  20
+
+// LVGL 9.2+ renders byte-swapped RGB565 itself, so the panel data needs no CPU swap
+#if LVGL_VERSION_MAJOR > 9 || (LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR >= 2)
+#define UI_NATIVE_SWAP 1
+#endif
+
+// Display flush throughput since the last report
+struct FlushStats {
+    uint32_t flushes = 0;
+    uint32_t pixels = 0;
+    uint32_t waitUs = 0;     // LVGL blocked on a transfer that had not finished
+    uint32_t sinceMs = 0;
+};
+
+// Network stats table: endpoint, count, avg connect/TTFB/transfer/parse, histogram
+#define UI_STATS_COLS      7
+#define UI_STATS_MAX_ROWS  8
+
+// Build the next exam/quiz question offscreen in idle passes, so advancing
+// is a screen swap. 0 builds every question on demand (for comparing latency).
+#define UI_PREPARE_NEXT_QUESTION  1
+
+// Exam answer sheet: questions shown at once, and the pitch of each row
+#define UI_OVERVIEW_ROWS        5
+#define UI_OVERVIEW_ROW_HEIGHT  38
+
 // Timer enums for UI (match StudyManager.h)
 enum TimerModeUI {
     UI_TIMER_BASIC = 0,
@@ -43,6 +73,14 @@ public:
     void showQuestion(int qNum, int totalQ, const char* questionText, 
                       const char** options, int optionCount,
                       int pendingAnswer, int confirmedAnswer);
+    // Builds the screen showQuestion() would show for the same arguments
+    // without loading it; the matching showQuestion() call only swaps it in.
+    // Call on idle passes once the current question is up - repeats are free.
+    void prepareQuestion(int qNum, int totalQ, const char* questionText,
+                         const char** options, int optionCount,
+                         int pendingAnswer, int confirmedAnswer);
+    void discardPreparedQuestion();  // On starting or leaving an exam or quiz
+    void markInput() { inputAtUs = micros(); }  // Starts the input-to-question clock
     void showPauseMenu(int selectedIndex);
     void showOverview(int questionCount, int* answers, uint8_t* confirmed, int selectedIndex, int scrollOffset);
     void showResult(int score, int total, float percentage);
@@ -83,7 +121,10 @@ public:
     void showAdminURL(const char* url);
     
     // NEW: Dev Mode Menu
-    void showDevModeMenu(int selectedIndex, const char* apiUrl, bool serialDebug, bool showFPS, bool verboseNet);
+    void showDevModeMenu(int selectedIndex, const char* apiUrl, bool serialDebug, bool showFPS, bool verboseNet,
+                         const char* wifiInfo = nullptr);
+    void showNetworkStats(const char* summary, const char* cells[][UI_STATS_COLS], int rowCount,
+                          const char* lastRequest);
     
     // NEW: API URL Editor
     void showApiUrlEditor(const char* currentUrl, const char* editingUrl, int cursorPos);
@@ -101,11 +142,22 @@ public:
     void showTranscriptContent(const char* title, const char* content);
     void showSuccess(const char* title, const char* message);
     
+    // Transcript generation progress - built once, then updated in place
+    void showGenerationProgress(const char* title);
+    void updateGenerationProgress(const char* status, unsigned long elapsedSecs, int estimatePct);
+    
     // Update specific elements without full redraw
     void updateAnswerState(int optionIndex, int pendingAnswer, int confirmedAnswer);
     
-    // Get the TFT instance
-    TFT_eSPI& getTft() { return tft; }
+    // Get the TFT instance (waits out any DMA flush first, for direct drawing)
+    TFT_eSPI& getTft();
+    
+    // Flush throughput; printFlushStats() also starts a new window
+    const FlushStats& getFlushStats() { return flushStats; }
+    void printFlushStats();
+    
+    // Draw/flush/loop timing behind the Show FPS overlay
+    FrameStats& getFrameStats() { return frameStats; }
     
 private:
     TFT_eSPI tft = TFT_eSPI();
@@ -113,6 +165,14 @@ private:
     // LVGL 9.x display - uses lv_display_t instead of drivers
     static lv_display_t* display;
     static uint8_t* draw_buf;
+    static uint8_t* draw_buf2;   // LVGL renders into one while DMA sends the other
+    bool dmaEnabled = false;
+    bool flushInFlight = false;  // DMA started, CS still held
+    FlushStats flushStats;
+    unsigned long lastFlushReport = 0;
+    FrameStats frameStats;
+    lv_obj_t* fpsOverlay = nullptr;   // On lv_layer_top(), while Show FPS is on
+    unsigned long lastOverlayUpdate = 0;
     
     // Current screen objects
     lv_obj_t* currentScreen = nullptr;
@@ -120,8 +180,83 @@ private:
     lv_obj_t* questionLabel = nullptr;
     lv_obj_t* progressLabel = nullptr;
     
-    // Flush callback for LVGL 9.x
+    // A question screen and the arguments it was built from
+    struct QuestionScreen {
+        lv_obj_t* screen = nullptr;
+        lv_obj_t* progressLabel = nullptr;
+        lv_obj_t* questionLabel = nullptr;
+        lv_obj_t* answerBtns[4] = {nullptr};
+        int qNum = 0;
+        int totalQ = 0;
+        const char* text = nullptr;
+        int pending = -1;
+        int confirmed = -1;
+        
+        bool matches(int n, int total, const char* t, int p, int c) const {
+            return screen && qNum == n && totalQ == total && text == t && pending == p && confirmed == c;
+        }
+    };
+    QuestionScreen preparedQuestion;   // Built, not loaded
+    uint32_t inputAtUs = 0;
+    
+    // Recycling lists for the main menu and every picker, kept alive across
+    // screen changes (loadScreen() never deletes them). Only the rows that fit
+    // the viewport exist; moving the selection past an edge shifts the window
+    // and rebinds their text, so 500 items cost the same objects and redraw
+    // as 5.
+    struct VirtualList {
+        lv_obj_t* screen = nullptr;
+        lv_obj_t* title = nullptr;       // Header label
+        lv_obj_t* list = nullptr;        // Row container (does not scroll)
+        lv_obj_t* thumb = nullptr;       // Position indicator, for long lists
+        std::vector<lv_obj_t*> rows;     // One per visible slot: icon, text..., arrow
+        int first = 0;                   // Item shown in the top row
+        int selected = -1;
+    };
+    VirtualList menuScreen;
+    VirtualList listScreen;              // Exam, deck and quiz pickers
+    VirtualList transcriptScreen;
+    
+    // Generation progress screen objects (valid while genScreen is active)
+    lv_obj_t* genScreen = nullptr;
+    lv_obj_t* genStatusLabel = nullptr;
+    lv_obj_t* genElapsedLabel = nullptr;
+    lv_obj_t* genBar = nullptr;
+    
+    // Timer screen objects (valid while timerScreen is active). The screen is
+    // kept while the timer's mode, phase and pause state hold; each tick only
+    // retexts the digits and moves the arc, so LVGL flushes just those areas.
+    enum TimerView { TIMER_VIEW_STUDY = 1, TIMER_VIEW_BASIC, TIMER_VIEW_POMODORO };
+    struct TimerScreen {
+        lv_obj_t* screen = nullptr;
+        uint32_t key = 0;               // View and state it was built for
+        lv_obj_t* time = nullptr;       // Digits
+        lv_obj_t* arc = nullptr;        // Countdown progress, if shown
+    };
+    TimerScreen timerScreen;
+    
+    // Exam answer sheet (valid while answerSheet.screen is active). No
+    // object per question: one bare object paints the visible rows from the
+    // exam's own arrays, so a long exam costs LVGL nothing extra.
+    struct AnswerSheet {
+        lv_obj_t* screen = nullptr;
+        lv_obj_t* rows = nullptr;       // Drawn by drawAnswerSheet
+        const int* answers = nullptr;
+        const uint8_t* confirmed = nullptr;
+        int count = 0;
+        int first = 0;                  // Question in the top row
+        int selected = -1;
+        char numbers[UI_OVERVIEW_ROWS][8];  // Row number text, alive until redrawn
+    };
+    AnswerSheet answerSheet;
+    
+    // Flush callbacks for LVGL 9.x - disp_flush starts the transfer,
+    // flush_wait finishes it when LVGL needs the buffer back
     static void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+    static void flush_wait(lv_display_t *disp);
+    static void render_event(lv_event_t* e);
+    void finishFlush();
+    void updateFpsOverlay(bool enabled);
     
     // Helper methods
     lv_obj_t* createScreen();
@@ -131,6 +266,35 @@ private:
     lv_obj_t* createButton(lv_obj_t* parent, const char* text, bool primary = true);
     lv_obj_t* createAnswerButton(lv_obj_t* parent, int index, const char* text);
     void setAnswerButtonState(lv_obj_t* btn, int index, bool isPending, bool isConfirmed);
+    void setLabelText(lv_obj_t* label, const char* text);  // No copy for mapped content
+    void buildQuestion(QuestionScreen& qs, int qNum, int totalQ, const char* questionText,
+                       const char** options, int optionCount, int pendingAnswer, int confirmedAnswer);
+    void logQuestionTime(int qNum, bool swapped, uint32_t startUs);
+    
+    // Virtual lists
+    bool isRetained(lv_obj_t* scr) {
+        return scr == menuScreen.screen || scr == listScreen.screen || scr == transcriptScreen.screen;
+    }
+    lv_obj_t* createMenuRow(lv_obj_t* list);
+    lv_obj_t* createListRow(lv_obj_t* list);
+    lv_obj_t* createTranscriptRow(lv_obj_t* list);
+    template <typename CreateRow>
+    void createRows(VirtualList& vl, int rowHeight, CreateRow createRow);
+    template <typename BindRow>
+    void syncList(VirtualList& vl, int count, int selected, lv_color_t iconColor,
+                  lv_color_t iconSelectedColor, BindRow bindRow);
+    void showRetained(lv_obj_t* scr);
+    void logShowTime(const char* what, bool built, uint32_t startUs);
+    
+    // Timer screens
+    static uint32_t timerKey(TimerView view, uint8_t state, uint8_t session = 0, uint8_t total = 0);
+    bool isTimerScreenFor(uint32_t key);
+    void setTimerText(lv_obj_t* label, unsigned long secs);
+    void showTimerScreen(lv_obj_t* scr, uint32_t key);
+    
+    // Answer sheet
+    static void drawAnswerSheet(lv_event_t* e);
+    void invalidateSheetRow(int question);
 };
 
 // Singleton instance
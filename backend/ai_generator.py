@@ -17,6 +17,8 @@ from models import (
 
 # In-memory job storage im not getting into redis for this
 jobs: Dict[str, GenerationJob] = {}
+# Running asyncio tasks, so a job can be cancelled from the device
+job_tasks: Dict[str, asyncio.Task] = {}
 
 
 def get_client() -> anthropic.Anthropic:
@@ -45,6 +47,32 @@ def get_job(job_id: str) -> Optional[GenerationJob]:
     return jobs.get(job_id)
 
 
+def track_task(job_id: str, coro) -> None:
+    """Schedule a generation coroutine and remember it until it finishes"""
+    task = asyncio.create_task(coro)
+    job_tasks[job_id] = task
+    task.add_done_callback(lambda _: job_tasks.pop(job_id, None))
+
+
+def cancel_job(job_id: str) -> bool:
+    """Cancel a pending/processing job. Returns False if it already finished."""
+    job = jobs.get(job_id)
+    if not job or job.status in (JobStatus.COMPLETED, JobStatus.FAILED):
+        return False
+    task = job_tasks.pop(job_id, None)
+    if task:
+        task.cancel()
+    update_job(
+        job_id,
+        status=JobStatus.FAILED,
+        error="Cancelled by user",
+        completed_at=datetime.now(),
+        progress_message="Cancelled"
+    )
+    print(f"[AI] Job {job_id} cancelled")
+    return True
+
+
 def update_job(job_id: str, **kwargs):
     """Update job fields"""
     if job_id in jobs:
@@ -483,7 +511,7 @@ def start_generation_job(
     job = create_job(request.generation_type)
     
     # Schedule the async task
-    asyncio.create_task(generate_content(job.job_id, pdf_data, request))
+    track_task(job.job_id, generate_content(job.job_id, pdf_data, request))
     
     return job.job_id
 
@@ -595,6 +623,6 @@ def start_transcript_generation_job(request: GenerationRequest) -> str:
     job = create_job(request.generation_type)
     
     # Schedule the async task
-    asyncio.create_task(generate_from_transcript(job.job_id, request))
+    track_task(job.job_id, generate_from_transcript(job.job_id, request))
     
     return job.job_id
@@ -1,9 +1,10 @@
-from typing import List, Dict
+from typing import List, Dict, Set
 from models import Exam, StudentResult, Deck, Flashcard, Quiz, QuizQuestion
 
 # In-memory storage for simplicity and safety
 exams_db: Dict[str, Exam] = {}
 results_db: List[StudentResult] = []
+seen_submissions: Set[str] = set()
 decks_db: Dict[str, Deck] = {}
 quizzes_db: Dict[str, Quiz] = {}
 
@@ -78,8 +79,14 @@ def get_all_exams() -> List[Exam]:
 def get_exam(exam_id: str) -> Exam:
     return exams_db.get(exam_id)
 
-def add_result(result: StudentResult):
+def add_result(result: StudentResult) -> bool:
+    """Store a result; returns False for a retried submission already stored."""
+    if result.submission_id:
+        if result.submission_id in seen_submissions:
+            return False
+        seen_submissions.add(result.submission_id)
     results_db.append(result)
+    return True
 
 def get_results() -> List[StudentResult]:
     return results_db
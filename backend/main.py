@@ -1,6 +1,7 @@
-from fastapi import FastAPI, HTTPException, UploadFile, File, Form, BackgroundTasks
+from fastapi import FastAPI, HTTPException, UploadFile, File, Form, BackgroundTasks, Request
 from fastapi.middleware.cors import CORSMiddleware
-from fastapi.responses import JSONResponse
+from fastapi.responses import JSONResponse, Response
+from fastapi.encoders import jsonable_encoder
 from pydantic import BaseModel
 from typing import List, Optional
 from models import (
@@ -10,7 +11,13 @@ from models import (
 )
 import database
 import json
+import hashlib
+import asyncio
 import ai_generator
+try:
+    import msgpack  # Optional - detail endpoints fall back to JSON without it
+except ImportError:
+    msgpack = None
 from dotenv import load_dotenv
 
 # Load environment variables from .env file
@@ -26,57 +33,147 @@ app.add_middleware(
     allow_headers=["*"],
 )
 
+def encode_json(content):
+    """Serialize content exactly as it is served; returns (body, etag)."""
+    body = json.dumps(jsonable_encoder(content), separators=(",", ":"), ensure_ascii=False).encode("utf-8")
+    etag = '"' + hashlib.sha1(body).hexdigest()[:16] + '"'
+    return body, etag
+
+def conditional_json(request: Request, content) -> Response:
+    """JSON response with a content-hash ETag; answers 304 when the client's
+    If-None-Match already matches so the device can keep its cached copy."""
+    body, etag = encode_json(content)
+    if_none_match = request.headers.get("if-none-match", "")
+    if etag in [tag.strip() for tag in if_none_match.split(",")]:
+        return Response(status_code=304, headers={"ETag": etag})
+    return Response(content=body, media_type="application/json", headers={"ETag": etag})
+
+def wants_msgpack(request: Request) -> bool:
+    return msgpack is not None and "application/msgpack" in request.headers.get("accept", "")
+
+def conditional_content(request: Request, content) -> Response:
+    """Like conditional_json, but answers MessagePack when the device asks for it.
+    The ETag is the JSON content hash either way, so manifest versions and
+    cached validators stay valid whichever encoding was downloaded."""
+    if not wants_msgpack(request):
+        return conditional_json(request, content)
+    _, etag = encode_json(content)
+    headers = {"ETag": etag, "Vary": "Accept"}
+    if_none_match = request.headers.get("if-none-match", "")
+    if etag in [tag.strip() for tag in if_none_match.split(",")]:
+        return Response(status_code=304, headers=headers)
+    body = msgpack.packb(jsonable_encoder(content), use_bin_type=True)
+    return Response(content=body, media_type="application/msgpack", headers=headers)
+
+# Page size cap for catalog lists
+MAX_PAGE_LIMIT = 100
+
+def paged_list(request: Request, items, limit: Optional[int], cursor: Optional[str]) -> Response:
+    """Catalog list. Without ?limit the full models are returned as before.
+    With it, items are ordered by id and only id/title are sent, one page at
+    a time. X-Next-Cursor (the last id of the page) is set while more pages
+    remain, and X-Total-Count always. The ETag covers the whole catalog, so
+    the first page revalidates a device's complete cached list in one request."""
+    if limit is None:
+        return conditional_json(request, items)
+
+    summaries = sorted(({"id": item.id, "title": item.title} for item in items), key=lambda s: s["id"])
+    _, etag = encode_json(summaries)
+    headers = {"ETag": etag, "X-Total-Count": str(len(summaries))}
+    if not cursor:
+        if_none_match = request.headers.get("if-none-match", "")
+        if etag in [tag.strip() for tag in if_none_match.split(",")]:
+            return Response(status_code=304, headers=headers)
+
+    # Keyed on id rather than an offset, so deletions between pages skip nothing
+    remaining = [s for s in summaries if s["id"] > cursor] if cursor else summaries
+    limit = max(1, min(limit, MAX_PAGE_LIMIT))
+    page = remaining[:limit]
+    if len(remaining) > limit:
+        headers["X-Next-Cursor"] = page[-1]["id"]
+
+    body, _ = encode_json(page)
+    return Response(content=body, media_type="application/json", headers=headers)
+
 @app.get("/")
 def read_root():
     return {"message": "Welcome to StudyEngine API"}
 
+def manifest_entries(items):
+    entries = []
+    for item in items:
+        body, etag = encode_json(item)
+        entries.append({"id": item.id, "title": item.title, "version": etag, "size": len(body)})
+    return entries
+
+@app.get("/manifest")
+def get_manifest():
+    """Everything the device can cache, with per-item versions matching the
+    ETag of the detail endpoint, so one request tells it what changed."""
+    return {
+        "exams": manifest_entries(database.get_all_exams()),
+        "decks": manifest_entries(database.get_all_decks()),
+        "quizzes": manifest_entries(database.get_all_quizzes()),
+    }
+
 @app.post("/exams/upload")
 def upload_exam(exam: Exam):
     database.add_exam(exam)
     return {"message": "Exam uploaded successfully", "exam_id": exam.id}
 
 @app.get("/exams", response_model=List[Exam])
-def list_exams():
-    return database.get_all_exams()
+def list_exams(request: Request, limit: Optional[int] = None, cursor: Optional[str] = None):
+    return paged_list(request, database.get_all_exams(), limit, cursor)
 
 @app.get("/exams/{exam_id}", response_model=Exam)
-def get_exam(exam_id: str):
+def get_exam(exam_id: str, request: Request):
     exam = database.get_exam(exam_id)
     if not exam:
         raise HTTPException(status_code=404, detail="Exam not found")
-    return exam
+    return conditional_content(request, exam)
 
 @app.post("/results")
 def submit_result(result: StudentResult):
-    database.add_result(result)
-    print(f"Received result for {result.student_name}: {result.score}/{result.total_questions}")
+    if database.add_result(result):
+        print(f"Received result for {result.student_name}: {result.score}/{result.total_questions}")
     return {"message": "Result received"}
 
+@app.post("/results/batch")
+def submit_results_batch(results: List[StudentResult]):
+    """Queued results from a device, several per request. Duplicates (retries
+    of a batch whose response was lost) are acknowledged but not stored twice."""
+    accepted = 0
+    for result in results:
+        if database.add_result(result):
+            accepted += 1
+            print(f"Received result for {result.student_name}: {result.score}/{result.total_questions}")
+    return {"accepted": accepted, "duplicates": len(results) - accepted}
+
 @app.get("/results", response_model=List[StudentResult])
 def get_results():
     return database.get_results()
 
 @app.get("/decks", response_model=List[Deck])
-def list_decks():
-    return database.get_all_decks()
+def list_decks(request: Request, limit: Optional[int] = None, cursor: Optional[str] = None):
+    return paged_list(request, database.get_all_decks(), limit, cursor)
 
 @app.get("/decks/{deck_id}", response_model=Deck)
-def get_deck(deck_id: str):
+def get_deck(deck_id: str, request: Request):
     deck = database.get_deck(deck_id)
     if not deck:
         raise HTTPException(status_code=404, detail="Deck not found")
-    return deck
+    return conditional_content(request, deck)
 
 @app.get("/quizzes", response_model=List[Quiz])
-def list_quizzes():
-    return database.get_all_quizzes()
+def list_quizzes(request: Request, limit: Optional[int] = None, cursor: Optional[str] = None):
+    return paged_list(request, database.get_all_quizzes(), limit, cursor)
 
 @app.get("/quizzes/{quiz_id}", response_model=Quiz)
-def get_quiz(quiz_id: str):
+def get_quiz(quiz_id: str, request: Request):
     quiz = database.get_quiz(quiz_id)
     if not quiz:
         raise HTTPException(status_code=404, detail="Quiz not found")
-    return quiz
+    return conditional_content(request, quiz)
 
 @app.post("/admin/upload/exam")
 async def admin_upload_exam(file: UploadFile = File(...)):
@@ -203,25 +300,47 @@ async def generate_flashcards_from_pdf(
     
     return {"job_id": job_id, "message": "Flashcard generation started"}
 
+# Upper bound for long-polls - stays under the device's request timeout
+MAX_STATUS_WAIT_SECONDS = 25
+
 @app.get("/generate/status/{job_id}", response_model=GenerationResponse)
-async def get_generation_status(job_id: str):
+async def get_generation_status(job_id: str, wait: float = 0):
     """
     Get the status of a generation job.
-    Poll this endpoint to check if generation is complete.
+    Poll this endpoint to check if generation is complete. With ?wait=N the
+    request is held (long-poll) until the job finishes, its progress message
+    changes, or N seconds pass - one round trip instead of N polls.
     """
     job = ai_generator.get_job(job_id)
     if not job:
         raise HTTPException(status_code=404, detail="Job not found")
     
+    deadline = asyncio.get_event_loop().time() + min(max(wait, 0), MAX_STATUS_WAIT_SECONDS)
+    last_progress = job.progress_message
+    while (job.status in (JobStatus.PENDING, JobStatus.PROCESSING)
+           and job.progress_message == last_progress
+           and asyncio.get_event_loop().time() < deadline):
+        await asyncio.sleep(0.25)
+        job = ai_generator.get_job(job_id)
+    
     return GenerationResponse(
         job_id=job.job_id,
         status=job.status,
         result=job.result,
         error=job.error,
         created_at=job.created_at,
-        completed_at=job.completed_at
+        completed_at=job.completed_at,
+        progress_message=job.progress_message
     )
 
+@app.post("/generate/cancel/{job_id}")
+async def cancel_generation(job_id: str):
+    """Cancel a running generation job (device B button)."""
+    if not ai_generator.get_job(job_id):
+        raise HTTPException(status_code=404, detail="Job not found")
+    cancelled = ai_generator.cancel_job(job_id)
+    return {"cancelled": cancelled}
+
 @app.post("/generate/save/{job_id}")
 async def save_generated_content(job_id: str):
     """
@@ -486,4 +605,5 @@ async def export_exam_answers_csv(exam_id: str):
 if __name__ == "__main__":
     import uvicorn
     # Run on 0.0.0.0 to be accessible by ESP32
-    uvicorn.run(app, host="0.0.0.0", port=8000)
+    # Longer keep-alive so the device can reuse its socket between requests
+    uvicorn.run(app, host="0.0.0.0", port=8000, timeout_keep_alive=30)
@@ -24,6 +24,7 @@ class StudentResult(BaseModel):
     score: int
     total_questions: int
     answers: List[int] # List of selected option indices
+    submission_id: Optional[str] = None  # Set by the device queue; retried uploads reuse it
 
 class Flashcard(BaseModel):
     front: str
@@ -106,5 +107,6 @@ class GenerationResponse(BaseModel):
     status: JobStatus
     result: Optional[Dict[str, Any]] = None
     error: Optional[str] = None
+    progress_message: Optional[str] = None
     created_at: datetime
     completed_at: Optional[datetime] = None
@@ -64,4 +64,26 @@
 #define DEFAULT_API_URL "http://172.20.10.11:8000"
 #define MAX_URL_LENGTH 128
 
+// ===================================================================================
+// SYSTEM STATES
+// ===================================================================================
+// Top-level modes. Engines hand the next one back through `systemState`, so
+// always use these names - add new states at the end.
+enum SystemState {
+    STATE_MENU,
+    STATE_SETTINGS,
+    STATE_ADMIN_URL,
+    STATE_DEV_MODE,
+    STATE_API_URL_EDIT,
+    STATE_HW_TEST,
+    STATE_SCANATRON_SETUP,
+    STATE_SCANATRON_RUN,
+    STATE_STUDY_TIMER,
+    STATE_FLASHCARDS,
+    STATE_QUIZ,
+    STATE_TRANSCRIPT,
+    STATE_RESULTS,
+    STATE_NET_STATS
+};
+
 #endif
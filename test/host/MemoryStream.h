@@ -0,0 +1,38 @@
+/**
+ * Host helper - a Stream over a body held in memory, standing in for the
+ * HTTP response stream the parsers read on the device
+ */
+
+#ifndef HOST_MEMORY_STREAM_H
+#define HOST_MEMORY_STREAM_H
+
+#include <Arduino.h>
+
+class MemoryStream : public Stream {
+private:
+    const char* data;
+    size_t size;
+    size_t pos = 0;
+
+public:
+    MemoryStream(const char* body, size_t length) : data(body), size(length) {
+        setTimeout(0);   // End of body is end of input - nothing more will arrive
+    }
+    explicit MemoryStream(const std::string& body) : MemoryStream(body.data(), body.size()) {}
+
+    int available() override { return size - pos; }
+    int read() override { return pos < size ? (uint8_t)data[pos++] : -1; }
+    int peek() override { return pos < size ? (uint8_t)data[pos] : -1; }
+    size_t readBytes(char* buffer, size_t length) override {
+        size_t n = length < size - pos ? length : size - pos;
+        memcpy(buffer, data + pos, n);
+        pos += n;
+        return n;
+    }
+    using Stream::readBytes;
+    size_t write(uint8_t) override { return 0; }
+
+    size_t position() const { return pos; }
+};
+
+#endif
@@ -0,0 +1,232 @@
+/**
+ * Host benchmark - JSON vs MessagePack content bodies through ArduinoJson
+ * Every body is decoded the way the firmware decodes it:
+ *   - item by item, deserializeJson vs deserializeMsgPack from a Stream,
+ *     with the firmware's item filters into STREAM_CARD_DOC_SIZE /
+ *     STREAM_QUESTION_DOC_SIZE documents
+ *   - end to end through parseDeckStream / parseQuizStream / parseExamStream
+ * and reports body size, median decode time and the peak memoryUsage() of
+ * the item document.
+ *
+ * Content: backend/sample_exam.json, any deck/quiz/exam bodies named on the
+ * command line (save them from the backend with curl), and synthetic decks
+ * and quizzes shaped like the generator's output.
+ *
+ * Times are host CPU times - compare the two formats, not the device. The
+ * host has 64-bit pointers, so ArduinoJson's slots and memoryUsage() are
+ * larger than on the ESP32; the ratio between the formats holds.
+ *
+ * Build and run: make -C test/host bench ARDUINOJSON=<path to ArduinoJson/src>
+ */
+
+#include "ContentParser.h"
+#include "MemoryStream.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#define BENCH_RUNS      200
+#define BENCH_DOC_SIZE  (4 * 1024 * 1024)   // Whole synthetic body, only to build the encodings
+
+struct Body {
+    std::string name;
+    ContentKind kind;
+    std::string json;
+    std::string msgpack;
+    std::vector<std::string> jsonItems;   // Each card/question on its own
+    std::vector<std::string> msgpackItems;
+};
+
+struct Result {
+    double parseUs = 0;     // Whole body through the firmware parser
+    double itemsUs = 0;     // All items through deserializeJson/deserializeMsgPack
+    size_t peakMemory = 0;  // Largest item document, memoryUsage()
+    bool ok = true;
+};
+
+static double nowUs() {
+    using namespace std::chrono;
+    return duration_cast<duration<double, std::micro>>(steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename Fn>
+static double medianUs(Fn run) {
+    std::vector<double> samples;
+    for (int i = 0; i < BENCH_RUNS; i++) {
+        double start = nowUs();
+        run();
+        samples.push_back(nowUs() - start);
+    }
+    std::sort(samples.begin(), samples.end());
+    return samples[BENCH_RUNS / 2];
+}
+
+// ===================================================================================
+// CONTENT
+// ===================================================================================
+
+// Both encodings come from one document, as the backend serves one model
+static void encode(Body& body, const JsonDocument& doc) {
+    serializeJson(doc, body.json);
+    serializeMsgPack(doc, body.msgpack);
+    const char* itemKey = (body.kind == CONTENT_DECK) ? "cards" : "questions";
+    for (JsonVariantConst item : doc[itemKey].as<JsonArrayConst>()) {
+        body.jsonItems.emplace_back();
+        serializeJson(item, body.jsonItems.back());
+        body.msgpackItems.emplace_back();
+        serializeMsgPack(item, body.msgpackItems.back());
+    }
+}
+
+static bool loadFile(const char* path, std::vector<Body>& bodies) {
+    std::ifstream in(path);
+    if (!in) {
+        printf("Cannot open %s\n", path);
+        return false;
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+
+    DynamicJsonDocument doc(BENCH_DOC_SIZE);
+    DeserializationError error = deserializeJson(doc, text.str());
+    if (error) {
+        printf("Cannot parse %s: %s\n", path, error.c_str());
+        return false;
+    }
+
+    Body body;
+    const char* slash = strrchr(path, '/');
+    body.name = slash ? slash + 1 : path;
+    if (doc.containsKey("cards")) body.kind = CONTENT_DECK;
+    else if (doc.containsKey("duration_minutes")) body.kind = CONTENT_EXAM;
+    else body.kind = CONTENT_QUIZ;
+    encode(body, doc);
+    bodies.push_back(body);
+    return true;
+}
+
+static void syntheticDeck(int cardCount, std::vector<Body>& bodies) {
+    DynamicJsonDocument doc(BENCH_DOC_SIZE);
+    doc["id"] = "bench-deck-" + std::to_string(cardCount);
+    doc["title"] = "Benchmark Deck (" + std::to_string(cardCount) + " cards)";
+    JsonArray cards = doc.createNestedArray("cards");
+    for (int i = 0; i < cardCount; i++) {
+        std::string n = std::to_string(i);
+        JsonObject card = cards.createNestedObject();
+        card["front"] = "Question " + n + ": What does the term number " + n + " describe in this lecture?";
+        card["back"] = "Answer " + n + ": a short definition of roughly the length a student would write.";
+    }
+
+    Body body;
+    body.name = "synthetic deck " + std::to_string(cardCount);
+    body.kind = CONTENT_DECK;
+    encode(body, doc);
+    bodies.push_back(body);
+}
+
+static void syntheticQuiz(int questionCount, std::vector<Body>& bodies) {
+    DynamicJsonDocument doc(BENCH_DOC_SIZE);
+    doc["id"] = "bench-quiz-" + std::to_string(questionCount);
+    doc["title"] = "Benchmark Quiz (" + std::to_string(questionCount) + " questions)";
+    JsonArray questions = doc.createNestedArray("questions");
+    for (int i = 0; i < questionCount; i++) {
+        std::string n = std::to_string(i);
+        JsonObject q = questions.createNestedObject();
+        q["id"] = i + 1;
+        q["type"] = "mcq";
+        q["text"] = "Which of the following best describes concept " + n + "?";
+        JsonArray options = q.createNestedArray("options");
+        for (char letter : std::string("ABCD")) {
+            options.add(std::string(1, letter) + ") Option " + letter + " for concept " + n);
+        }
+        q["correct_answer"] = "B";
+    }
+
+    Body body;
+    body.name = "synthetic quiz " + std::to_string(questionCount);
+    body.kind = CONTENT_QUIZ;
+    encode(body, doc);
+    bodies.push_back(body);
+}
+
+// ===================================================================================
+// DECODE
+// ===================================================================================
+
+static bool parseBody(ContentKind kind, const std::string& data, WireFormat format) {
+    MemoryStream stream(data);
+    switch (kind) {
+        case CONTENT_DECK: {
+            Deck deck;
+            return parseDeckStream(stream, deck, format);
+        }
+        case CONTENT_QUIZ: {
+            Quiz quiz;
+            return parseQuizStream(stream, quiz, format);
+        }
+        case CONTENT_EXAM: {
+            ExamData exam;
+            return parseExamStream(stream, exam, [](const Question&) {}, format);
+        }
+    }
+    return false;
+}
+
+static Result measure(const Body& body, WireFormat format) {
+    Result r;
+    const std::string& data = (format == WIRE_MSGPACK) ? body.msgpack : body.json;
+    const std::vector<std::string>& items = (format == WIRE_MSGPACK) ? body.msgpackItems : body.jsonItems;
+
+    r.ok = parseBody(body.kind, data, format);
+    if (!r.ok) return r;
+    r.parseUs = medianUs([&] { parseBody(body.kind, data, format); });
+
+    // Same document and filter as the firmware's per-item loop
+    bool deck = (body.kind == CONTENT_DECK);
+    DynamicJsonDocument doc(deck ? STREAM_CARD_DOC_SIZE : STREAM_QUESTION_DOC_SIZE);
+    JsonVariantConst filter = deck ? cardFilter() : questionFilter();
+    r.itemsUs = medianUs([&] {
+        for (const std::string& item : items) {
+            MemoryStream stream(item);
+            doc.clear();
+            DeserializationError error = (format == WIRE_MSGPACK)
+                ? deserializeMsgPack(doc, stream, DeserializationOption::Filter(filter))
+                : deserializeJson(doc, stream, DeserializationOption::Filter(filter));
+            if (error) r.ok = false;
+            r.peakMemory = std::max(r.peakMemory, doc.memoryUsage());
+        }
+    });
+    return r;
+}
+
+int main(int argc, char** argv) {
+    std::vector<Body> bodies;
+    for (int i = 1; i < argc; i++) {
+        if (!loadFile(argv[i], bodies)) return 1;
+    }
+    syntheticDeck(200, bodies);
+    syntheticDeck(1000, bodies);
+    syntheticQuiz(100, bodies);
+
+    printf("%-28s%9s%9s%6s  %10s%10s  %10s%10s  %9s%9s\n", "content", "json B", "mp B", "size",
+           "json us", "mp us", "item j us", "item m us", "json mem", "mp mem");
+    bool ok = true;
+    for (const Body& body : bodies) {
+        Result json = measure(body, WIRE_JSON);
+        Result msgpack = measure(body, WIRE_MSGPACK);
+        if (!json.ok || !msgpack.ok) {
+            printf("%-28s parse failed (json %s, msgpack %s)\n", body.name.substr(0, 27).c_str(),
+                   json.ok ? "ok" : "failed", msgpack.ok ? "ok" : "failed");
+            ok = false;
+            continue;
+        }
+        printf("%-28s%9u%9u%5.0f%%  %10.1f%10.1f  %10.1f%10.1f  %9u%9u\n", body.name.substr(0, 27).c_str(),
+               (unsigned)body.json.size(), (unsigned)body.msgpack.size(),
+               100.0 * body.msgpack.size() / body.json.size(), json.parseUs, msgpack.parseUs,
+               json.itemsUs, msgpack.itemsUs, (unsigned)json.peakMemory, (unsigned)msgpack.peakMemory);
+    }
+    printf("\njson/mp us: whole body through the firmware parser, median of %d runs\n", BENCH_RUNS);
+    printf("item j/m us: every item deserialized on its own with the firmware filter\n");
+    printf("json/mp mem: peak memoryUsage() of one item document (64-bit host)\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+/**
+ * Host shim - the slice of the Arduino core the content pack and parser
+ * code uses. ArduinoJson is built with its Arduino String/Stream support on,
+ * so it reads these classes exactly as it reads the device's.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <strings.h>
+#include <string>
+#include <vector>
+#include <functional>
+#include <chrono>
+
+class String {
+private:
+    std::string s;
+
+public:
+    String() = default;
+    String(const char* c) : s(c ? c : "") {}
+    String(const std::string& str) : s(str) {}
+
+    const char* c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    bool concat(const char* c) { if (c) s += c; return true; }
+    bool concat(const char* c, unsigned int len) { s.append(c, len); return true; }
+    bool concat(const String& other) { s += other.s; return true; }
+
+    String& operator=(const char* c) { s = c ? c : ""; return *this; }
+    String& operator+=(const String& other) { s += other.s; return *this; }
+    bool operator==(const String& other) const { return s == other.s; }
+    bool operator==(const char* c) const { return s == (c ? c : ""); }
+    bool operator!=(const String& other) const { return s != other.s; }
+
+    friend String operator+(const String& a, const String& b) { return String(a.s + b.s); }
+    friend String operator+(const char* a, const String& b) { return String(std::string(a) + b.s); }
+};
+
+// Named by ArduinoJson's String adapter
+class StringSumHelper : public String {
+public:
+    using String::String;
+};
+
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t) = 0;
+};
+
+class Stream : public Print {
+protected:
+    unsigned long timeout = 1000;
+
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t n = 0;
+        int c;
+        while (n < length && (c = read()) >= 0) buffer[n++] = (char)c;
+        return n;
+    }
+    size_t readBytes(uint8_t* buffer, size_t length) { return readBytes((char*)buffer, length); }
+    void setTimeout(unsigned long ms) { timeout = ms; }
+    unsigned long getTimeout() { return timeout; }
+};
+
+// Streams that wrap a memory buffer never wait for data
+inline void yield() {}
+
+struct HostSerial {
+    bool quiet = true;   // Engine logging is noise in test output
+    void printf(const char* fmt, ...) {
+        if (quiet) return;
+        va_list args;
+        va_start(args, fmt);
+        vprintf(fmt, args);
+        va_end(args);
+    }
+    void println(const char* s) { if (!quiet) puts(s); }
+};
+extern HostSerial Serial;
+
+struct HostEsp {
+    uint32_t getFreeHeap() { return 0; }
+};
+extern HostEsp ESP;
+
+inline unsigned long micros() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+inline unsigned long millis() { return micros() / 1000; }
+
+inline size_t host_strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if (size) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+#define strlcpy host_strlcpy
+
+#endif
@@ -0,0 +1,78 @@
+/**
+ * Host shim - fs::FS and File over stdio, rooted in a scratch directory
+ */
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include "Arduino.h"
+#include <memory>
+
+namespace fs {
+
+class File {
+private:
+    struct Handle {
+        FILE* fp;
+        bool writeError = false;
+        explicit Handle(FILE* f) : fp(f) {}
+        ~Handle() { if (fp) fclose(fp); }
+    };
+    std::shared_ptr<Handle> h;   // Copies share the open file, as on the device
+
+public:
+    File() = default;
+    explicit File(FILE* fp) { if (fp) h = std::make_shared<Handle>(fp); }
+
+    explicit operator bool() const { return h && h->fp; }
+
+    size_t read(uint8_t* buf, size_t len) { return *this ? fread(buf, 1, len, h->fp) : 0; }
+    size_t write(const uint8_t* buf, size_t len) {
+        if (!*this) return 0;
+        size_t n = fwrite(buf, 1, len, h->fp);
+        if (n != len) h->writeError = true;
+        return n;
+    }
+    size_t write(uint8_t b) { return write(&b, 1); }
+    bool seek(uint32_t pos) { return *this && fseek(h->fp, pos, SEEK_SET) == 0; }
+    size_t position() { return *this ? ftell(h->fp) : 0; }
+    size_t size() {
+        if (!*this) return 0;
+        long at = ftell(h->fp);
+        fseek(h->fp, 0, SEEK_END);
+        long end = ftell(h->fp);
+        fseek(h->fp, at, SEEK_SET);
+        return end;
+    }
+    int getWriteError() { return h && h->writeError; }
+    void close() {
+        if (h && h->fp) {
+            fclose(h->fp);
+            h->fp = nullptr;
+        }
+        h.reset();
+    }
+};
+
+class FS {
+private:
+    std::string root;
+
+public:
+    explicit FS(const std::string& rootDir) : root(rootDir) {}
+
+    File open(const char* path, const char* mode = "r") {
+        const char* m = (mode[0] == 'w') ? "w+b" : (mode[0] == 'a') ? "a+b" : "rb";
+        return File(fopen((root + path).c_str(), m));
+    }
+    File open(const String& path, const char* mode = "r") { return open(path.c_str(), mode); }
+    bool remove(const char* path) { return ::remove((root + path).c_str()) == 0; }
+    bool remove(const String& path) { return remove(path.c_str()); }
+};
+
+}  // namespace fs
+
+using fs::FS;
+using fs::File;
+
+#endif
@@ -0,0 +1,12 @@
+/**
+ * Host shim - network classes exist only as SENetworkManager members
+ */
+
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+class WiFiClient {};
+class HTTPClient {};
+class Preferences {};
+
+#endif
@@ -0,0 +1 @@
+#include "WiFi.h"
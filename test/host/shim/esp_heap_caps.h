@@ -0,0 +1,14 @@
+/**
+ * Host shim - heap statistics read as zero
+ */
+
+#ifndef HOST_ESP_HEAP_CAPS_H
+#define HOST_ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+
+#define MALLOC_CAP_8BIT  (1 << 2)
+
+inline size_t heap_caps_get_largest_free_block(unsigned int) { return 0; }
+
+#endif
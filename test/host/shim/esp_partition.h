@@ -0,0 +1,10 @@
+/**
+ * Host shim - partitions are never mapped in host tests
+ */
+
+#ifndef HOST_ESP_PARTITION_H
+#define HOST_ESP_PARTITION_H
+
+typedef struct esp_partition_t esp_partition_t;
+
+#endif
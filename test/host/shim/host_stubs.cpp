@@ -0,0 +1,20 @@
+/**
+ * Host shim - globals and partition hooks the pack code links against.
+ * Nothing is ever mirrored, so pins are inert.
+ */
+
+#include "ContentPack.h"
+
+HostSerial Serial;
+HostEsp ESP;
+ContentPartition contentPartition;
+
+ContentPin::ContentPin(ContentPartition& partition) : owner(&partition) {}
+
+ContentPin& ContentPin::operator=(ContentPin&& other) noexcept {
+    owner = other.owner;
+    other.owner = nullptr;
+    return *this;
+}
+
+void ContentPin::release() { owner = nullptr; }
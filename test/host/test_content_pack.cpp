@@ -0,0 +1,313 @@
+/**
+ * Content parse and pack round trips on the host
+ * Bodies go through the firmware's own streaming parser (ContentParser.cpp)
+ * and pack writer/reader, the way syncExam, syncDeck and fetchQuiz use them:
+ *   - backend/sample_exam.json, as JSON and re-encoded as MessagePack, is
+ *     spooled into an exam pack and every question is read back
+ *   - a quiz with letter, index, option-text and short answers goes through
+ *     writeQuiz/loadQuiz
+ *   - a deck goes through writeDeck/loadDeck and single-card reads
+ *   - truncated bodies fail to parse; truncated, corrupt and old-version
+ *     packs are refused by PackReader
+ *
+ * Build and run: make -C test/host ARDUINOJSON=<path to ArduinoJson/src>
+ */
+
+#include "ContentParser.h"
+#include "ContentPack.h"
+#include "MemoryStream.h"
+#include <fstream>
+#include <sstream>
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+#define CHECK_STR(a, b) do { \
+    const char* a_ = (a); \
+    const char* b_ = (b); \
+    if (!a_ || !b_ || strcmp(a_, b_) != 0) { \
+        printf("FAIL %s:%d: \"%s\" != \"%s\"\n", __FILE__, __LINE__, a_ ? a_ : "(null)", b_ ? b_ : "(null)"); \
+        failures++; \
+    } \
+} while (0)
+
+static const char* SCRATCH_DIR = "/tmp";
+
+// Question fields in an unusual order, unknown fields (nested and numeric)
+// to skip, and every answer form the backend sends
+static const char* QUIZ_BODY = R"({
+    "questions": [
+        {"id": 1, "type": "mcq", "text": "Letter answer", "options": ["A1", "B1", "C1", "D1"], "correct_answer": "C"},
+        {"id": 2, "type": "mcq", "text": "Index answer", "options": ["zero", "one", "two"], "correct_answer": "1"},
+        {"correct_answer": "green", "options": ["Red", "Green", "Blue"], "text": "Text answer", "type": "mcq", "id": 3,
+         "explanation": "Case does not matter"},
+        {"id": 4, "type": "short_answer", "text": "Which bus uses SDA and SCL?", "correct_answer": "I2C"},
+        {"id": 5, "type": "mcq", "text": "Unmatched answer", "options": ["yes", "no"], "correct_answer": "maybe"}
+    ],
+    "generator": {"model": "any", "revision": 3},
+    "score_weight": -1.5e2,
+    "id": "quiz-host",
+    "title": "Host \"quiz\""
+})";
+
+static const char* DECK_BODY = R"({"id": "deck-host", "title": "Host deck", "cards": [
+    {"front": "GPIO", "back": "General Purpose Input/Output", "tags": ["hw"]},
+    {"back": "Inter-Integrated Circuit", "front": "I2C"}
+], "card_count": 2})";
+
+static std::string readFile(fs::FS& fs, const char* path) {
+    File f = fs.open(path, "r");
+    std::string data(f.size(), '\0');
+    f.read((uint8_t*)&data[0], data.size());
+    f.close();
+    return data;
+}
+
+static void writeFile(fs::FS& fs, const char* path, const std::string& data) {
+    File f = fs.open(path, "w");
+    f.write((const uint8_t*)data.data(), data.size());
+    f.close();
+}
+
+// ===================================================================================
+// EXAM
+// ===================================================================================
+
+static void testExamRoundTrip(JsonObjectConst src, const std::string& body, WireFormat format, fs::FS& fs) {
+    JsonArrayConst srcQuestions = src["questions"];
+    CHECK(srcQuestions.size() > 0);
+
+    // Parsed straight into the spool, as syncExam does
+    PackSpooler spool;
+    CHECK(spool.begin(fs, "/exam_records.tmp", "/exam_pool.tmp"));
+    MemoryStream stream(body);
+    ExamData exam;
+    CHECK(parseExamStream(stream, exam, [&](const Question& q) { CHECK(spool.addQuestion(q)); }, format));
+    CHECK(spool.count() == srcQuestions.size());
+    CHECK_STR(exam.id.c_str(), src["id"].as<const char*>());
+    CHECK_STR(exam.title.c_str(), src["title"].as<const char*>());
+    CHECK(exam.durationMinutes == src["duration_minutes"].as<int>());
+    CHECK(exam.showResultsImmediate == src["show_results_immediate"].as<bool>());
+
+    File out = fs.open("/exam.pack", "w");
+    CHECK((bool)out);
+    CHECK(spool.finish(out, exam));
+    out.close();
+    spool.discard();
+
+    PackReader reader;
+    CHECK(reader.open(fs.open("/exam.pack", "r"), PACK_EXAM));
+    CHECK(reader.count() == srcQuestions.size());
+
+    ExamData loaded;
+    CHECK(reader.loadExamInfo(loaded));
+    CHECK_STR(loaded.id.c_str(), exam.id.c_str());
+    CHECK_STR(loaded.title.c_str(), exam.title.c_str());
+    CHECK(loaded.durationMinutes == exam.durationMinutes);
+    CHECK(loaded.showResultsImmediate == exam.showResultsImmediate);
+
+    StringArena arena;
+    for (size_t i = 0; i < srcQuestions.size(); i++) {
+        JsonObjectConst sq = srcQuestions[i];
+        JsonArrayConst options = sq["options"];
+        Question q;
+        CHECK(reader.loadQuestion(i, q, arena));
+        CHECK(q.id == sq["id"].as<int>());
+        CHECK(q.kind == QUESTION_MCQ);
+        CHECK_STR(q.text, sq["text"].as<const char*>());
+        CHECK(q.optionCount == options.size());
+        for (uint8_t o = 0; o < q.optionCount; o++) {
+            CHECK_STR(q.options[o], options[o].as<const char*>());
+        }
+        CHECK(q.correctOption == sq["correct_option"].as<int>());
+    }
+
+    // Out of range reads fail instead of returning garbage
+    Question past;
+    CHECK(!reader.loadQuestion(srcQuestions.size(), past, arena));
+    reader.close();
+
+    // A deck reader must refuse an exam pack
+    CHECK(!reader.open(fs.open("/exam.pack", "r"), PACK_DECK));
+    fs.remove("/exam.pack");
+}
+
+// A body cut off anywhere must not parse as complete
+static void testTruncatedBody(const std::string& body, WireFormat format) {
+    const size_t cuts[] = {1, body.size() / 3, body.size() / 2, body.size() - 2};
+    for (size_t cut : cuts) {
+        MemoryStream stream(body.data(), cut);
+        ExamData exam;
+        int questions = 0;
+        CHECK(!parseExamStream(stream, exam, [&](const Question&) { questions++; }, format));
+    }
+}
+
+// ===================================================================================
+// QUIZ
+// ===================================================================================
+
+static void testQuizRoundTrip(fs::FS& fs) {
+    Quiz quiz;
+    MemoryStream stream(QUIZ_BODY, strlen(QUIZ_BODY));
+    CHECK(parseQuizStream(stream, quiz));
+    CHECK_STR(quiz.id.c_str(), "quiz-host");
+    CHECK_STR(quiz.title.c_str(), "Host \"quiz\"");
+    CHECK(quiz.questions.size() == 5);
+    if (quiz.questions.size() != 5) return;
+
+    // Answers resolved once, at parse time
+    CHECK(quiz.questions[0].correctOption == 2);
+    CHECK(quiz.questions[1].correctOption == 1);
+    CHECK(quiz.questions[2].correctOption == 1);
+    CHECK(quiz.questions[2].id == 3);
+    CHECK(quiz.questions[3].kind == QUESTION_SHORT_ANSWER);
+    CHECK(quiz.questions[3].correctOption == -1);
+    CHECK(quiz.questions[3].optionCount == 0);
+    CHECK_STR(quiz.questions[3].correctText, "I2C");
+    CHECK(quiz.questions[4].correctOption == -1);
+
+    File out = fs.open("/quiz.pack", "w");
+    CHECK(PackWriter::writeQuiz(out, quiz));
+    out.close();
+
+    PackReader reader;
+    CHECK(reader.open(fs.open("/quiz.pack", "r"), PACK_QUIZ));
+    Quiz loaded;
+    CHECK(reader.loadQuiz(loaded));
+    reader.close();
+    CHECK_STR(loaded.id.c_str(), quiz.id.c_str());
+    CHECK_STR(loaded.title.c_str(), quiz.title.c_str());
+    CHECK(loaded.questions.size() == quiz.questions.size());
+    for (size_t i = 0; i < loaded.questions.size() && i < quiz.questions.size(); i++) {
+        const Question& a = loaded.questions[i];
+        const Question& b = quiz.questions[i];
+        CHECK(a.id == b.id);
+        CHECK(a.kind == b.kind);
+        CHECK_STR(a.text, b.text);
+        CHECK(a.optionCount == b.optionCount);
+        for (uint8_t o = 0; o < a.optionCount && o < b.optionCount; o++) CHECK_STR(a.options[o], b.options[o]);
+        CHECK(a.correctOption == b.correctOption);
+        CHECK_STR(a.correctText, b.correctText);
+    }
+}
+
+// Run after testQuizRoundTrip - damages copies of its pack
+static void testBadPacks(fs::FS& fs) {
+    std::string good = readFile(fs, "/quiz.pack");
+    CHECK(good.size() > sizeof(PackHeader));
+
+    std::string truncated = good.substr(0, good.size() - 1);
+    std::string headerOnly = good.substr(0, sizeof(PackHeader) - 4);
+    std::string badMagic = good;
+    badMagic[0] ^= 0xFF;
+    std::string oldVersion = good;
+    oldVersion[offsetof(PackHeader, version)] = PACK_VERSION - 1;
+    std::string badRecordSize = good;
+    badRecordSize[offsetof(PackHeader, recordSize)] = sizeof(PackQuestionRecord) - 1;
+
+    PackReader reader;
+    for (const std::string* bad : {&truncated, &headerOnly, &badMagic, &oldVersion, &badRecordSize}) {
+        writeFile(fs, "/bad.pack", *bad);
+        CHECK(!reader.open(fs.open("/bad.pack", "r"), PACK_QUIZ));
+        CHECK(!reader.isOpen());
+    }
+
+    // The intact copy still opens, but only as what it is
+    writeFile(fs, "/bad.pack", good);
+    CHECK(!reader.open(fs.open("/bad.pack", "r"), PACK_EXAM));
+    CHECK(reader.open(fs.open("/bad.pack", "r"), PACK_QUIZ));
+    reader.close();
+
+    fs.remove("/bad.pack");
+    fs.remove("/quiz.pack");
+}
+
+// ===================================================================================
+// DECK
+// ===================================================================================
+
+static void testDeckRoundTrip(fs::FS& fs) {
+    Deck deck;
+    MemoryStream stream(DECK_BODY, strlen(DECK_BODY));
+    CHECK(parseDeckStream(stream, deck));
+    CHECK_STR(deck.id.c_str(), "deck-host");
+    CHECK_STR(deck.title.c_str(), "Host deck");
+    CHECK(deck.cards.size() == 2);
+    if (deck.cards.size() != 2) return;
+    CHECK_STR(deck.cards[1].front, "I2C");
+    CHECK_STR(deck.cards[1].back, "Inter-Integrated Circuit");
+
+    File out = fs.open("/deck.pack", "w");
+    CHECK(PackWriter::writeDeck(out, deck));
+    out.close();
+
+    PackReader reader;
+    CHECK(reader.open(fs.open("/deck.pack", "r"), PACK_DECK));
+    CHECK(reader.count() == deck.cards.size());
+
+    // Single card faces, as FlashcardEngine reads them
+    char face[PACK_TEXT_MAX];
+    PackCardRecord rec;
+    CHECK(reader.readCard(0, rec));
+    reader.readString(rec.frontRef, face, sizeof(face));
+    CHECK_STR(face, deck.cards[0].front);
+
+    Deck loaded;
+    CHECK(reader.loadDeck(loaded));
+    CHECK_STR(loaded.id.c_str(), deck.id.c_str());
+    CHECK_STR(loaded.title.c_str(), deck.title.c_str());
+    CHECK(loaded.cards.size() == deck.cards.size());
+    for (size_t i = 0; i < loaded.cards.size() && i < deck.cards.size(); i++) {
+        CHECK_STR(loaded.cards[i].front, deck.cards[i].front);
+        CHECK_STR(loaded.cards[i].back, deck.cards[i].back);
+    }
+    reader.close();
+    fs.remove("/deck.pack");
+
+    // Cut off mid-card: false, so the caller drops the deck
+    Deck partial;
+    MemoryStream cut(DECK_BODY, strlen(DECK_BODY) / 2);
+    CHECK(!parseDeckStream(cut, partial));
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "../../backend/sample_exam.json";
+    std::ifstream in(path);
+    if (!in) {
+        printf("Cannot open %s\n", path);
+        return 1;
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    std::string json = text.str();
+
+    // Whole-document parse as the reference for the streamed one
+    DynamicJsonDocument src(json.size() * 4);
+    DeserializationError error = deserializeJson(src, json);
+    if (error) {
+        printf("Cannot parse %s: %s\n", path, error.c_str());
+        return 1;
+    }
+    std::string msgpack;
+    serializeMsgPack(src, msgpack);
+
+    fs::FS fs(SCRATCH_DIR);
+    testExamRoundTrip(src.as<JsonObjectConst>(), json, WIRE_JSON, fs);
+    testExamRoundTrip(src.as<JsonObjectConst>(), msgpack, WIRE_MSGPACK, fs);
+    testTruncatedBody(json.substr(0, json.find_last_of('}') + 1), WIRE_JSON);
+    testTruncatedBody(msgpack, WIRE_MSGPACK);
+    testQuizRoundTrip(fs);
+    testBadPacks(fs);
+    testDeckRoundTrip(fs);
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("Content parse and pack round trips OK (%u exam questions)\n", (unsigned)src["questions"].size());
+    return 0;
+}